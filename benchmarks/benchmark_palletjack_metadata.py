@@ -95,6 +95,14 @@ def worker_palletjack_row_group_column_metadata():
 
     pj.read_metadata(cfg.index_path, row_groups = [0], column_indices = [0])
 
+def worker_palletjack_row_group_column_metadata_mmap():
+
+    pj.read_metadata(cfg.index_path, row_groups = [0], column_indices = [0], read_mode = 'mmap')
+
+def worker_index_reader_row_group_column_metadata(reader):
+
+    reader.read_metadata(row_groups = [0], column_names = ['column_0'])
+
 def worker_arrow_metadata():
 
     pr = pq.ParquetReader()
@@ -189,12 +197,15 @@ print(".")
 
 generate_data()
 index_data = fs.LocalFileSystem().open_input_stream(cfg.index_path).readall()
+index_reader = pj.IndexReader(cfg.index_path)
 
 for n_workers in cfg.worker_counts:
 
     print(".")
     print(f"pj.read_metadata(in_memory, row_groups[0]+columns[0]) n_workers:{n_workers}, duration:{measure_reading(n_workers, lambda:worker_inmemory_palletjack_row_group_column_metadata(index_data))}")
     print(f"pj.read_metadata(row_groups[0]+columns[0]) n_workers:{n_workers}, duration:{measure_reading(n_workers, worker_palletjack_row_group_column_metadata)}")
+    print(f"pj.read_metadata(mmap, row_groups[0]+columns[0]) n_workers:{n_workers}, duration:{measure_reading(n_workers, worker_palletjack_row_group_column_metadata_mmap)}")
+    print(f"pj.IndexReader.read_metadata(row_groups[0]+columns['column_0']) n_workers:{n_workers}, duration:{measure_reading(n_workers, lambda:worker_index_reader_row_group_column_metadata(index_reader))}")
     print(f"pj.read_metadata(row_groups[0]) n_workers:{n_workers}, duration:{measure_reading(n_workers, worker_palletjack_row_group_metadata)}")
     print(f"pj.read_metadata(column[0]) n_workers:{n_workers}, duration:{measure_reading(n_workers, worker_palletjack_column_metadata)}")
     print(f"pj.read_metadata(column['column_0']) n_workers:{n_workers}, duration:{measure_reading(n_workers, worker_palletjack_column_name_metadata)}")
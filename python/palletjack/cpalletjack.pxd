@@ -1,16 +1,90 @@
 from libcpp.vector cimport vector
 from libcpp.string cimport string
 from libcpp.memory cimport shared_ptr
+from libcpp.utility cimport pair
+from libcpp.optional cimport optional
 from libc.stdint cimport uint32_t, int64_t
 from pyarrow._parquet cimport *
-
-cdef extern from "arrow/buffer.h" namespace "arrow":
-    cdef cppclass CArrowBuffer "arrow::Buffer":
-        const unsigned char* data()
-        int64_t size()
+from pyarrow.includes.libarrow cimport CBuffer, CExpression, CScalar
 
 cdef extern from "palletjack.h":
-    cdef shared_ptr[CArrowBuffer] GenerateMetadataIndex(const char *parquet_path) except + nogil
-    cdef void GenerateMetadataIndex(const char *parquet_path, const char *index_file_path) except + nogil
-    cdef shared_ptr[CFileMetaData] ReadMetadata(const char *index_file_path, const vector[uint32_t] row_groups, const vector[uint32_t] column_indices, const vector[string] column_names, bint schema_only) except + nogil
+    cdef enum class IndexReadMode:
+        ReadAll
+        ReadRanges
+        MemoryMap
+
+    cdef cppclass GenerateMetadataIndexOptions:
+        bint column_names_hash
+        uint32_t format_version
+        bint packed_offsets
+        bint column_major_offsets
+        bint row_group_statistics
+        bint sorted_key_index
+        bint strip_ranges
+
+    cdef shared_ptr[CBuffer] GenerateMetadataIndex(const char *parquet_path, const GenerateMetadataIndexOptions &options) except + nogil
+    cdef void GenerateMetadataIndex(const char *parquet_path, const char *index_file_path, const GenerateMetadataIndexOptions &options) except + nogil
+    cdef vector[string] GenerateMetadataIndexes(const vector[pair[string, string]] &parquet_and_index_file_paths, uint32_t num_threads, int64_t memory_limit, const GenerateMetadataIndexOptions &options) except + nogil
+    cdef shared_ptr[CFileMetaData] ReadMetadata(const char *index_file_path, const vector[uint32_t] row_groups, const vector[uint32_t] column_indices, const vector[string] column_names, bint schema_only, IndexReadMode read_mode) except + nogil
     cdef shared_ptr[CFileMetaData] ReadMetadata(const unsigned char *index_data, size_t index_data_length, const vector[uint32_t] row_groups, const vector[uint32_t] column_indices, const vector[string] column_names, bint schema_only) except + nogil
+
+cdef extern from "palletjack.h" namespace "palletjack":
+    cdef cppclass CRowRangeSelection "palletjack::RowRangeSelection":
+        vector[uint32_t] row_groups
+        int64_t first_row_group_offset
+        int64_t last_row_group_stop
+
+    # None can't be declared in Cython, the values are converted to int and looked up in STATISTICS_TYPES
+    cdef enum class CStatisticsType "palletjack::StatisticsType":
+        pass
+
+    cdef cppclass CColumnStatistics "palletjack::ColumnStatistics":
+        CStatisticsType type
+        shared_ptr[CBuffer] has_min_max
+        shared_ptr[CBuffer] has_null_count
+        shared_ptr[CBuffer] min
+        shared_ptr[CBuffer] max
+        shared_ptr[CBuffer] null_count
+
+    cdef cppclass CRowGroupFilter "palletjack::RowGroupFilter":
+        @staticmethod
+        CRowGroupFilter FromExpression(const CExpression &expression) except +
+
+    cdef cppclass CPreparedSelection "palletjack::PreparedSelection":
+        const vector[uint32_t]& column_indices()
+
+    cdef cppclass CIndexReader "palletjack::IndexReader":
+        @staticmethod
+        shared_ptr[CIndexReader] Open(const char *index_file_path, IndexReadMode read_mode) except + nogil
+        @staticmethod
+        shared_ptr[CIndexReader] Open(shared_ptr[CBuffer] index_data) except + nogil
+        uint32_t num_row_groups()
+        uint32_t num_columns()
+        int64_t num_rows()
+        CRowRangeSelection FindRowGroups(int64_t start, int64_t stop) except + nogil
+        shared_ptr[CFileMetaData] ReadMetadata(const vector[uint32_t] row_groups, const vector[uint32_t] column_indices, const vector[string] column_names, bint schema_only, bint project_arrow_schema, bint strip) except + nogil
+        shared_ptr[CPreparedSelection] Prepare(const vector[uint32_t] column_indices, const vector[string] column_names) except + nogil
+        shared_ptr[CFileMetaData] ReadMetadata(const CPreparedSelection &selection, const vector[uint32_t] row_groups, bint schema_only, bint project_arrow_schema, bint strip) except + nogil
+        shared_ptr[CBuffer] ReadMetadataBytes(const vector[uint32_t] row_groups, const vector[uint32_t] column_indices, const vector[string] column_names, bint schema_only, bint project_arrow_schema, bint strip) except + nogil
+        shared_ptr[CBuffer] ReadMetadataBytes(const CPreparedSelection &selection, const vector[uint32_t] row_groups, bint schema_only, bint project_arrow_schema, bint strip) except + nogil
+        bint has_row_group_statistics()
+        vector[CColumnStatistics] ReadRowGroupStatistics(const vector[uint32_t] column_indices, const vector[string] column_names) except + nogil
+        vector[uint32_t] PruneRowGroups(const CRowGroupFilter &filter) except + nogil
+        optional[uint32_t] sorted_key_column() except +
+        vector[uint32_t] FindRowGroupsByKey(const shared_ptr[CScalar] &min, const shared_ptr[CScalar] &max) except + nogil
+
+    cdef cppclass CIndexPackBuilder "palletjack::IndexPackBuilder":
+        void Add(const string &key, shared_ptr[CBuffer] index_data) except + nogil
+        size_t size()
+        shared_ptr[CBuffer] Finish() except + nogil
+        void Finish(const char *pack_path) except + nogil
+
+    cdef cppclass CIndexPack "palletjack::IndexPack":
+        @staticmethod
+        shared_ptr[CIndexPack] Open(const char *pack_path) except + nogil
+        @staticmethod
+        shared_ptr[CIndexPack] Open(shared_ptr[CBuffer] pack_data) except + nogil
+        uint32_t num_files()
+        vector[string] keys() except +
+        bint Contains(const string &key)
+        shared_ptr[CIndexReader] GetReader(const string &key) except + nogil
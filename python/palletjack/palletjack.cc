@@ -1,69 +1,215 @@
 #include "arrow/api.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/expression.h"
 #include "arrow/io/api.h"
+#include "arrow/ipc/api.h"
 #include "arrow/result.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/type_fwd.h"
+#include "arrow/util/ubsan.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/arrow/schema.h"
 
 #include "palletjack.h"
-
-// TCompactProtocol requires some #defines to work right.
-#define SIGNED_RIGHT_SHIFT_IS 1
-#define ARITHMETIC_RIGHT_SHIFT 1
-
-#include <thrift/TApplicationException.h>
-#include <thrift/protocol/TCompactProtocol.h>
-#include <thrift/transport/TBufferTransports.h>
+#include "thrift_compact.h"
 #include "parquet/exception.h"
 
-#include "parquet_types_palletjack.h"
-
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <chrono>
+#include <cmath>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// Picks the AVX2 version of the hot loops at runtime, the extension itself is built for the baseline instruction set
+#define PALLETJACK_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
 
 using arrow::Status;
 
 #define TO_FILE_ENDIANESS(x) (x)
 #define FROM_FILE_ENDIANESS(x) (x)
-const int HEADER_V1_LENGTH = 4;
-const char HEADER_V1[HEADER_V1_LENGTH] = {'P', 'J', '_', '2'};
+const int HEADER_LENGTH = 4;
+const char HEADER_V2[HEADER_LENGTH] = {'P', 'J', '_', '2'};
+const char HEADER_V3[HEADER_LENGTH] = {'P', 'J', '_', '3'};
+const uint32_t FORMAT_VERSION_3 = 3;
+// column_chunks_offsets is not stored in the body, it is in the ExtensionSectionId::PackedColumnChunksOffsets section
+const uint32_t FLAG_PACKED_COLUMN_CHUNKS_OFFSETS = 1;
+// column_chunks_offsets is stored column-major, (1 + c + 1) entries of rg offsets, so a column across row groups is contiguous
+const uint32_t FLAG_COLUMN_MAJOR_COLUMN_CHUNKS_OFFSETS = 2;
+// The schema has groups (structs, lists, maps), so its elements besides the root outnumber the columns (the leaves).
+// The schema tables have an entry per element and the column names are the dotted paths of the elements.
+const uint32_t FLAG_NESTED_SCHEMA = 4;
+const uint32_t SUPPORTED_FLAGS = FLAG_PACKED_COLUMN_CHUNKS_OFFSETS | FLAG_COLUMN_MAJOR_COLUMN_CHUNKS_OFFSETS | FLAG_NESTED_SCHEMA;
+
+// On-disk header of PJ_2 indexes
+struct DataHeaderV2
+{
+    char header[HEADER_LENGTH] = {'P', 'J', '_', '2'};
+    uint32_t row_groups = 0;
+    uint32_t columns = 0;
+    uint32_t column_names_length = 0;
+    uint32_t metadata_length = 0;
+};
+
+// On-disk header of PJ_3 indexes, the size keeps the tables that follow it 8-byte aligned
+struct DataHeaderV3
+{
+    char header[HEADER_LENGTH] = {'P', 'J', '_', '3'};
+    uint32_t version = FORMAT_VERSION_3;
+    uint32_t row_groups = 0;
+    uint32_t columns = 0;
+    uint32_t column_names_length = 0;
+    uint32_t metadata_length = 0;
+    uint32_t flags = 0;
+    uint32_t schema_elements = 0; // FLAG_NESTED_SCHEMA only, 0 otherwise
+};
 
+// Format independent view of the index header. Offsets into the metadata stay 32-bit in every version,
+// as the parquet footer length is 32-bit, but the body of an index can be larger than 4 GiB.
 struct DataHeader
 {
-    char header[HEADER_V1_LENGTH] = {'P', 'J', '_', '2'};
+    uint32_t version = 2;
     uint32_t row_groups = 0;
     uint32_t columns = 0;
     uint32_t column_names_length = 0;
     uint32_t metadata_length = 0;
+    uint32_t flags = 0;           // PJ_3 only
+    uint32_t schema_elements = 0; // PJ_3 with FLAG_NESTED_SCHEMA only
+
+    bool has_packed_column_chunks_offsets() const { return (flags & FLAG_PACKED_COLUMN_CHUNKS_OFFSETS) != 0; }
+    bool has_column_major_column_chunks_offsets() const { return (flags & FLAG_COLUMN_MAJOR_COLUMN_CHUNKS_OFFSETS) != 0; }
+    bool has_nested_schema() const { return (flags & FLAG_NESTED_SCHEMA) != 0; }
+    // The schema elements besides the root, which are the columns unless the schema is nested
+    uint32_t get_schema_elements() const { return has_nested_schema() ? schema_elements : columns; }
+    uint64_t get_header_size() const { return version == 2 ? sizeof(DataHeaderV2) : sizeof(DataHeaderV3); }
+    uint64_t get_row_number_size() const { return version == 2 ? sizeof(uint32_t) : sizeof(int64_t); }
 
-    uint32_t get_num_rows_offsets_size() const { return 2; }                                   // 2
-    uint32_t get_row_numbers_size() const { return row_groups; }                               // rg
-    uint32_t get_schema_offsets_size() const { return 1 + 1 + columns + 1; }                   // 1 + 1 + c + 1
-    uint32_t get_schema_num_children_offsets_size() const { return (columns + 1) * (1 + 1); }  // (c + 1) * (1 + 1)
-    uint32_t get_row_groups_offsets_size() const { return 1 + row_groups + 1; }                // 1 + rg + 1
-    uint32_t get_column_orders_offsets_size() const { return 1 + columns + 1; }                // 1 + c + 1
-    uint32_t get_column_chunks_offsets_size() const { return row_groups * (1 + columns + 1); } // rg * (1 + c + 1)
-    uint32_t get_body_size() const
+    uint64_t get_num_rows_offsets_size() const { return 2; }                                                       // 2
+    uint64_t get_row_numbers_size() const { return row_groups; }                                                   // rg
+    uint64_t get_schema_offsets_size() const { return 1 + 1 + uint64_t(get_schema_elements()) + 1; }              // 1 + 1 + e + 1
+    uint64_t get_schema_num_children_offsets_size() const { return (uint64_t(get_schema_elements()) + 1) * (1 + 1); } // (e + 1) * (1 + 1)
+    uint64_t get_row_groups_offsets_size() const { return 1 + uint64_t(row_groups) + 1; }                          // 1 + rg + 1
+    uint64_t get_column_orders_offsets_size() const { return 1 + uint64_t(columns) + 1; }                          // 1 + c + 1
+    uint64_t get_column_chunks_offsets_size() const { return uint64_t(row_groups) * (1 + uint64_t(columns) + 1); } // rg * (1 + c + 1)
+    uint64_t get_stored_column_chunks_offsets_size() const { return has_packed_column_chunks_offsets() ? 0 : get_column_chunks_offsets_size(); }
+    uint64_t get_body_size() const
     {
         return get_num_rows_offsets_size() * sizeof(uint32_t) +
-               get_row_numbers_size() * sizeof(uint32_t) +
+               get_row_numbers_size() * get_row_number_size() +
                get_schema_offsets_size() * sizeof(uint32_t) +
                get_schema_num_children_offsets_size() * sizeof(uint32_t) +
                get_row_groups_offsets_size() * sizeof(uint32_t) +
                get_column_orders_offsets_size() * sizeof(uint32_t) +
-               get_column_chunks_offsets_size() * sizeof(uint32_t) +
+               get_stored_column_chunks_offsets_size() * sizeof(uint32_t) +
                column_names_length +
                metadata_length;
     }
+    uint64_t get_index_size() const { return get_header_size() + get_body_size(); }
 };
 
+// Returns the size of the on-disk header that data starts with, 0 if the format is unknown (data has at least HEADER_LENGTH bytes)
+inline size_t GetDataHeaderSize(const uint8_t *data)
+{
+    if (memcmp(HEADER_V2, data, HEADER_LENGTH) == 0)
+        return sizeof(DataHeaderV2);
+    if (memcmp(HEADER_V3, data, HEADER_LENGTH) == 0)
+        return sizeof(DataHeaderV3);
+    return 0;
+}
+
+// data has GetDataHeaderSize(data) bytes
+DataHeader ParseDataHeader(const uint8_t *data)
+{
+    DataHeader dataHeader;
+    if (GetDataHeaderSize(data) == sizeof(DataHeaderV2))
+    {
+        DataHeaderV2 header;
+        memcpy(&header, data, sizeof(header));
+        dataHeader.row_groups = FROM_FILE_ENDIANESS(header.row_groups);
+        dataHeader.columns = FROM_FILE_ENDIANESS(header.columns);
+        dataHeader.column_names_length = FROM_FILE_ENDIANESS(header.column_names_length);
+        dataHeader.metadata_length = FROM_FILE_ENDIANESS(header.metadata_length);
+        return dataHeader;
+    }
+
+    DataHeaderV3 header;
+    memcpy(&header, data, sizeof(header));
+    if (FROM_FILE_ENDIANESS(header.version) != FORMAT_VERSION_3)
+    {
+        auto msg = std::string("Index format version=") + std::to_string(FROM_FILE_ENDIANESS(header.version)) + " is not supported!";
+        throw std::logic_error(msg);
+    }
+
+    // A packed table is always row-major
+    auto flags = FROM_FILE_ENDIANESS(header.flags);
+    if ((flags & ~SUPPORTED_FLAGS) != 0 ||
+        ((flags & FLAG_PACKED_COLUMN_CHUNKS_OFFSETS) != 0 && (flags & FLAG_COLUMN_MAJOR_COLUMN_CHUNKS_OFFSETS) != 0))
+    {
+        auto msg = std::string("Index flags=") + std::to_string(flags) + " are not supported!";
+        throw std::logic_error(msg);
+    }
+
+    dataHeader.version = FORMAT_VERSION_3;
+    dataHeader.row_groups = FROM_FILE_ENDIANESS(header.row_groups);
+    dataHeader.columns = FROM_FILE_ENDIANESS(header.columns);
+    dataHeader.column_names_length = FROM_FILE_ENDIANESS(header.column_names_length);
+    dataHeader.metadata_length = FROM_FILE_ENDIANESS(header.metadata_length);
+    dataHeader.flags = flags;
+    dataHeader.schema_elements = FROM_FILE_ENDIANESS(header.schema_elements);
+    if (dataHeader.has_nested_schema() ? dataHeader.schema_elements <= dataHeader.columns : dataHeader.schema_elements != 0)
+    {
+        auto msg = std::string("Index schema elements=") + std::to_string(dataHeader.schema_elements) + " are invalid!";
+        throw std::logic_error(msg);
+    }
+
+    return dataHeader;
+}
+
+void WriteDataHeader(arrow::io::OutputStream *fs, const DataHeader &dataHeader)
+{
+    if (dataHeader.version == 2)
+    {
+        DataHeaderV2 header;
+        header.row_groups = TO_FILE_ENDIANESS(dataHeader.row_groups);
+        header.columns = TO_FILE_ENDIANESS(dataHeader.columns);
+        header.column_names_length = TO_FILE_ENDIANESS(dataHeader.column_names_length);
+        header.metadata_length = TO_FILE_ENDIANESS(dataHeader.metadata_length);
+        PARQUET_THROW_NOT_OK(fs->Write(&header, sizeof(header)));
+        return;
+    }
+
+    DataHeaderV3 header;
+    header.row_groups = TO_FILE_ENDIANESS(dataHeader.row_groups);
+    header.columns = TO_FILE_ENDIANESS(dataHeader.columns);
+    header.column_names_length = TO_FILE_ENDIANESS(dataHeader.column_names_length);
+    header.metadata_length = TO_FILE_ENDIANESS(dataHeader.metadata_length);
+    header.flags = TO_FILE_ENDIANESS(dataHeader.flags);
+    header.schema_elements = TO_FILE_ENDIANESS(dataHeader.has_nested_schema() ? dataHeader.schema_elements : 0);
+    PARQUET_THROW_NOT_OK(fs->Write(&header, sizeof(header)));
+}
+
 /* File format: (Thrift-encoded metadata stored separately for each row group)
 -----------------------------
 | 0 ... | DataHeader        |
 |---------------------------|
-|       | 'PJ_2'            | (char[4]) - File header in ASCI
+|       | 'PJ_2' / 'PJ_3'   | (char[4]) - File header in ASCI
+|       --------------------|
+|       | version           | (uint32) - Format version, PJ_3 only
 |       --------------------|
 |       | row groups        | (uint32) - Number of row groups
 |       --------------------|
@@ -72,607 +218,4707 @@ struct DataHeader
 |       | col. names length | (uint32) - Length of column names section
 |       --------------------|
 |       | metadata length   | (uint32) - Length of metadata section
+|       --------------------|
+|       | flags             | (uint32) - FLAG_* bits, PJ_3 only
+|       --------------------|
+|       | schema elements   | (uint32) - Schema elements besides the root with FLAG_NESTED_SCHEMA, otherwise 0, PJ_3 only
+|---------------------------|
+| . . . | offset tables     | (uint32[]) - Offsets into the metadata section, row numbers are int64 in PJ_3,
+|       |                   | column_chunks_offsets is omitted with FLAG_PACKED_COLUMN_CHUNKS_OFFSETS
+|       |                   | and transposed with FLAG_COLUMN_MAJOR_COLUMN_CHUNKS_OFFSETS
 |---------------------------|
-| . . . | column names      | ['col_0', '\0', 'col_1', '\0', ....] - Section with column names
+| . . . | column names      | ['col_0', '\0', 'col_1', '\0', ....] - Section with column names,
+|       |                   | the dotted paths of all schema elements with FLAG_NESTED_SCHEMA
 |---------------------------|
 | . . . | metadata          | [bytes] - Section with original metadata (thrift compact protocol)
+|---------------------------|
+| . . . | extensions        | Optional, starts at the end of the body aligned to 8 bytes
+|       --------------------|
+|       | 'PJX1'            | (char[4]) - Extensions header in ASCI
+|       --------------------|
+|       | sections          | (uint32) - Number of extension sections
+|       --------------------|
+|       | section directory | (ExtensionSection[sections]) - Id, offset and length of each section
+|       --------------------|
+|       | section payloads  | [bytes] - Each payload is aligned to 8 bytes
 -----------------------------
 */
 
-constexpr int32_t kDefaultThriftStringSizeLimit = 100 * 1000 * 1000;
-constexpr int32_t kDefaultThriftContainerSizeLimit = 1000 * 1000;
+const int EXTENSIONS_HEADER_V1_LENGTH = 4;
+const char EXTENSIONS_HEADER_V1[EXTENSIONS_HEADER_V1_LENGTH] = {'P', 'J', 'X', '1'};
 
-using ThriftBuffer = apache::thrift::transport::TMemoryBuffer;
+// Readers skip the sections they don't know, so new sections can be added without changing the body layout
+enum class ExtensionSectionId : uint32_t
+{
+    ColumnNamesHash = 1,
+    PackedColumnChunksOffsets = 2,
+    RowGroupStatistics = 3,
+    SortedKey = 4,
+    StripRanges = 5,
+};
 
-std::shared_ptr<ThriftBuffer> CreateReadOnlyMemoryBuffer(uint8_t *buf, uint32_t len)
+struct ExtensionsHeader
 {
-    auto conf = std::make_shared<apache::thrift::TConfiguration>();
-    conf->setMaxMessageSize(std::numeric_limits<int>::max());
-    return std::make_shared<ThriftBuffer>(buf, len, ThriftBuffer::OBSERVE, conf);
-}
+    char header[EXTENSIONS_HEADER_V1_LENGTH] = {'P', 'J', 'X', '1'};
+    uint32_t sections = 0;
+};
+
+struct ExtensionSection
+{
+    uint32_t id = 0;
+    uint32_t flags = 0;
+    uint64_t offset = 0; // From the start of the index
+    uint64_t length = 0;
+};
+
+inline uint64_t AlignExtensionOffset(uint64_t offset) { return (offset + 7) & ~uint64_t(7); }
+inline uint64_t GetExtensionsOffset(const DataHeader &dataHeader) { return AlignExtensionOffset(dataHeader.get_index_size()); }
+
+// Parquet footer: metadata length (uint32) followed by the magic bytes
+constexpr int64_t kFooterSize = 8;
+const char kParquetMagic[4] = {'P', 'A', 'R', '1'};
+const char kParquetEMagic[4] = {'P', 'A', 'R', 'E'};
+constexpr int32_t kDefaultThriftStringSizeLimit = 100 * 1000 * 1000;
+constexpr int32_t kDefaultThriftContainerSizeLimit = 1000 * 1000;
+// Gaps smaller than this are read rather than skipped in IndexReadMode::ReadRanges (same as Arrow's default for the read range cache)
+constexpr int64_t kRangeReadHoleSizeLimit = 8 * 1024;
 
-void DeserializeUnencryptedMessage(const uint8_t *buf, uint32_t *len,
-                                   palletjack::parquet::FileMetaData *deserialized_msg)
+// A loaded part of the metadata section, offset is relative to the start of the metadata section
+struct MetadataBlock
 {
-    // Deserialize msg bytes into c++ thrift msg using memory transport.
-    auto tmem_transport = CreateReadOnlyMemoryBuffer(const_cast<uint8_t *>(buf), *len);
-    apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
-    // Protect against CPU and memory bombs
-    tproto_factory.setStringSizeLimit(kDefaultThriftStringSizeLimit);
-    tproto_factory.setContainerSizeLimit(kDefaultThriftContainerSizeLimit);
-    auto tproto = tproto_factory.getProtocol(tmem_transport);
+    size_t offset;
+    const uint8_t *data;
+    size_t size;
+};
 
-    try
-    {
-        deserialized_msg->read(tproto.get());
-    }
-    catch (std::exception &e)
+// SpliceMetadata compiled into steps, each copying a range of the metadata section (adjacent ranges are merged
+// into one) followed by the bytes written in between, so ThriftCopier can execute it in a tight loop
+class ThriftCopyPlan
+{
+public:
+    struct Step
     {
-        std::stringstream ss;
-        ss << "Couldn't deserialize thrift: " << e.what() << "\n";
-        throw parquet::ParquetException(ss.str());
-    }
-    uint32_t bytes_left = tmem_transport->available_read();
-    *len = *len - bytes_left;
-}
+        size_t src_idx;
+        size_t length;
+        size_t literal_length; // Bytes taken from the literals after the copy
+    };
 
-class ThriftCopier
-{
-    const uint8_t *src;
-    const uint8_t *src_end;
-    std::shared_ptr<arrow::ResizableBuffer> dst_buffer;
-    size_t dst_idx;
-    std::shared_ptr<ThriftBuffer> mem_buffer;
-    apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
-    std::shared_ptr<apache::thrift::protocol::TProtocol> tproto;
+private:
+    std::vector<Step> steps;
+    std::vector<uint8_t> literals;
+    size_t dst_size = 0;
 
-    inline void CopyFrom(const uint8_t *src, size_t to_copy)
+    // Adds the last length bytes of literals to the plan
+    void AppendLiteral(size_t length)
     {
-        if (dst_idx + to_copy > static_cast<size_t>(dst_buffer->size()))
-        {
-            auto msg = std::string("No space left in the destination buffer, dst_idx=") + std::to_string(dst_idx) + ", to_copy=" + std::to_string(to_copy) + ", size=" + std::to_string(dst_buffer->size());
-            throw std::logic_error(msg);
-        }
+        if (steps.empty())
+            steps.push_back({0, 0, 0});
 
-        memcpy(dst_buffer->mutable_data() + dst_idx, src, to_copy);
-        dst_idx += to_copy;
+        steps.back().literal_length += length;
+        dst_size += length;
     }
 
-public:
-    ThriftCopier(const uint8_t *src, size_t size) : src(src),
-                                                    src_end(src + size),
-                                                    dst_idx(0),
-                                                    mem_buffer(new ThriftBuffer(16))
+    // Encodes up to max_length bytes straight into literals
+    template <typename TEncode>
+    void WriteEncoded(size_t max_length, TEncode encode)
     {
-        PARQUET_ASSIGN_OR_THROW(dst_buffer, arrow::AllocateResizableBuffer(size));
-        // Protect against CPU and memory bombs
-        tproto_factory.setStringSizeLimit(kDefaultThriftStringSizeLimit);
-        tproto_factory.setContainerSizeLimit(kDefaultThriftContainerSizeLimit);
-        tproto = tproto_factory.getProtocol(mem_buffer);
+        auto size = literals.size();
+        literals.resize(size + max_length);
+        auto begin = literals.data() + size;
+        auto length = encode(begin) - begin;
+        literals.resize(size + length);
+        AppendLiteral(length);
     }
 
+public:
     inline void CopyFrom(size_t src_idx, size_t to_copy)
     {
-        if (src + src_idx + to_copy > src_end)
+        if (to_copy == 0)
+            return;
+
+        dst_size += to_copy;
+        if (!steps.empty() && steps.back().literal_length == 0 && steps.back().src_idx + steps.back().length == src_idx)
         {
-            auto msg = std::string("Requested reading outside source range, src_idx=") + std::to_string(src_idx) + ", to_copy=" + std::to_string(to_copy) + ", size=" + std::to_string(src_end - src);
-            throw std::logic_error(msg);
+            steps.back().length += to_copy;
+            return;
         }
 
-        CopyFrom(src + src_idx, to_copy);
+        steps.push_back({src_idx, to_copy, 0});
+    }
+
+    // Writes bytes as they are, e.g. the schema list spliced by a prepared selection
+    void WriteBytes(const uint8_t *data, size_t length)
+    {
+        if (length == 0)
+            return;
+
+        literals.insert(literals.end(), data, data + length);
+        AppendLiteral(length);
     }
 
-    void WriteListBegin(const ::apache::thrift::protocol::TType elemType, uint32_t size)
+    void WriteListBegin(thrift_compact::Type element_type, uint32_t size)
     {
-        mem_buffer->resetBuffer();
-        tproto->writeListBegin(elemType, static_cast<uint32_t>(size));
-        uint8_t *ptr;
-        uint32_t len;
-        mem_buffer->getBuffer(&ptr, &len);
-        CopyFrom(ptr, len);
+        WriteEncoded(thrift_compact::kMaxListBeginLength, [&](uint8_t *dst)
+                     { return thrift_compact::WriteListBegin(dst, element_type, size); });
     }
 
     void WriteI32(int32_t value)
     {
-        mem_buffer->resetBuffer();
-        tproto->writeI32(value);
-        uint8_t *ptr;
-        uint32_t len;
-        mem_buffer->getBuffer(&ptr, &len);
-        CopyFrom(ptr, len);
+        WriteEncoded(thrift_compact::kMaxVarintLength, [&](uint8_t *dst)
+                     { return thrift_compact::WriteI32(dst, value); });
     }
 
     void WriteI64(int64_t value)
     {
-        mem_buffer->resetBuffer();
-        tproto->writeI64(value);
-        uint8_t *ptr;
-        uint32_t len;
-        mem_buffer->getBuffer(&ptr, &len);
-        CopyFrom(ptr, len);
+        WriteEncoded(thrift_compact::kMaxVarintLength, [&](uint8_t *dst)
+                     { return thrift_compact::WriteI64(dst, value); });
     }
 
-    size_t GetDataSize() { return dst_idx; }
-
-    const uint8_t *GetData() { return dst_buffer->data(); }
-};
-
-palletjack::parquet::FileMetaData DeserializeFileMetadata(const void *buf, uint32_t len)
-{
-    palletjack::parquet::FileMetaData fileMetaData;
-    DeserializeUnencryptedMessage((const uint8_t *)buf, &len, &fileMetaData);
-    return fileMetaData;
-}
+    // A binary or string value, its length followed by its bytes
+    void WriteBinary(std::string_view value)
+    {
+        WriteEncoded(thrift_compact::kMaxVarintLength, [&](uint8_t *dst)
+                     { return thrift_compact::WriteVarint(dst, value.size()); });
+        WriteBytes(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    }
 
-std::shared_ptr<arrow::Buffer> GenerateMetadataIndex(const char *parquet_path)
-{
-    std::shared_ptr<arrow::Buffer> thrift_buffer;
-    DataHeader data_header = {};
+    size_t GetDataSize() const { return dst_size; }
+    const std::vector<Step> &GetSteps() const { return steps; }
+    const std::vector<uint8_t> &GetLiterals() const { return literals; }
 
+    // The ranges of the metadata section the plan reads
+    std::vector<arrow::io::ReadRange> GetRanges() const
     {
-        std::shared_ptr<arrow::io::ReadableFile> infile;
-        PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(std::string(parquet_path)));
-        auto metadata = parquet::ReadMetaData(infile);
-
-        if (metadata->is_encryption_algorithm_set())
+        std::vector<arrow::io::ReadRange> ranges;
+        ranges.reserve(steps.size());
+        for (const auto &step : steps)
         {
-            throw parquet::ParquetException(
-                "Encrypted column metadata is not supported: '" + std::string(parquet_path) + "'.");
+            if (step.length > 0)
+                ranges.push_back({static_cast<int64_t>(step.src_idx), static_cast<int64_t>(step.length)});
         }
 
-        std::shared_ptr<arrow::io::BufferOutputStream> metadata_stream;
-        PARQUET_ASSIGN_OR_THROW(metadata_stream, arrow::io::BufferOutputStream::Create(1024, arrow::default_memory_pool()));
-        metadata.get()->WriteTo(metadata_stream.get());
-        PARQUET_ASSIGN_OR_THROW(thrift_buffer, metadata_stream.get()->Finish());
-        data_header.row_groups = metadata->num_row_groups();
-        data_header.columns = metadata->num_columns();
-        data_header.metadata_length = thrift_buffer.get()->size();
-
-        for (uint32_t c = 0; c < data_header.columns; c++)
-        {
-            data_header.column_names_length += metadata.get()->schema()->Column(c)->name().length() + 1;
-        }
+        return ranges;
     }
+};
 
-    auto metadata = DeserializeFileMetadata(thrift_buffer.get()->data(), thrift_buffer.get()->size());
+// Executes a ThriftCopyPlan against the loaded parts of the metadata section
+class ThriftCopier
+{
+    std::vector<MetadataBlock> src_blocks; // sorted by offset, non-overlapping
+    size_t src_size;
 
-    // Validate data
+    inline const uint8_t *GetSource(size_t src_idx, size_t to_copy) const
     {
-        if (data_header.row_groups == 0)
-            throw std::logic_error("Number of row groups is not set!");
-        if (data_header.columns == 0)
-            throw std::logic_error("Number of columns is not set!");
-        if (data_header.metadata_length == 0)
-            throw std::logic_error("Metadata length is not set!");
-
-        if (data_header.get_num_rows_offsets_size() != metadata.num_rows_offsets.size())
+        // Find the last block starting at or before src_idx
+        auto block = src_blocks.size() == 1 ? src_blocks.end() : std::upper_bound(src_blocks.begin(), src_blocks.end(), src_idx, [](size_t idx, const MetadataBlock &b)
+                                                                                   { return idx < b.offset; });
+        if (block == src_blocks.begin() || src_idx + to_copy > std::prev(block)->offset + std::prev(block)->size)
         {
-            auto msg = std::string("Number of rows offset information is invalid, ") + std::to_string(data_header.get_num_rows_offsets_size()) + " != " + std::to_string(metadata.num_rows_offsets.size()) + " !";
+            auto msg = std::string("Requested reading outside source range, src_idx=") + std::to_string(src_idx) + ", to_copy=" + std::to_string(to_copy) + ", size=" + std::to_string(src_size);
             throw std::logic_error(msg);
         }
 
-        if (data_header.row_groups != metadata.row_numbers.size())
-        {
-            auto msg = std::string("Row numbers information is invalid, ") + std::to_string(data_header.row_groups) + " != " + std::to_string(metadata.row_numbers.size()) + " !";
-            throw std::logic_error(msg);
-        }
+        --block;
+        return block->data + (src_idx - block->offset);
+    }
 
-        if (data_header.get_schema_offsets_size() != metadata.schema_offsets.size())
-        {
-            auto msg = std::string("Schema offsets information is invalid, columns=") + std::to_string(data_header.columns) + ", schema_offsets=" + std::to_string(metadata.schema_offsets.size()) + " !";
-            throw std::logic_error(msg);
-        }
+public:
+    ThriftCopier(const uint8_t *src, size_t size) : ThriftCopier({{0, src, size}}, size)
+    {
+    }
+
+    ThriftCopier(std::vector<MetadataBlock> src_blocks, size_t size) : src_blocks(std::move(src_blocks)),
+                                                                       src_size(size)
+    {
+    }
 
-        for (auto &schema_element : metadata.schema)
+    // Returns a buffer of exactly plan.GetDataSize() bytes
+    std::shared_ptr<arrow::Buffer> Copy(const ThriftCopyPlan &plan)
+    {
+        std::shared_ptr<arrow::ResizableBuffer> dst_buffer;
+        PARQUET_ASSIGN_OR_THROW(dst_buffer, arrow::AllocateResizableBuffer(plan.GetDataSize()));
+        auto dst = dst_buffer->mutable_data();
+        auto literals = plan.GetLiterals().data();
+        for (const auto &step : plan.GetSteps())
         {
-            if (schema_element.num_children_offsets.size() == 0)
+            if (step.length > 0)
             {
-                schema_element.num_children_offsets.push_back(0);
-                schema_element.num_children_offsets.push_back(0);
+                memcpy(dst, GetSource(step.src_idx, step.length), step.length);
+                dst += step.length;
             }
-            else if (schema_element.num_children_offsets.size() != 2)
-            {
-                auto msg = std::string("Num children offsets information is invalid, num_children_offsets=") + std::to_string(schema_element.num_children_offsets.size()) + " !";
 
-                throw std::logic_error(msg);
-            }
+            memcpy(dst, literals, step.literal_length);
+            dst += step.literal_length;
+            literals += step.literal_length;
         }
 
-        if (data_header.get_row_groups_offsets_size() != metadata.row_groups_offsets.size())
-        {
-            auto msg = std::string("Row group offsets information is invalid, columns=") + std::to_string(data_header.row_groups) + ", row_groups_offsets=" + std::to_string(metadata.row_groups_offsets.size()) + " !";
+        return dst_buffer;
+    }
+};
 
-            throw std::logic_error(msg);
-        }
+// Merges ranges which are closer to each other than hole_size_limit, so that they can be fetched with a single read
+std::vector<arrow::io::ReadRange> CoalesceReadRanges(std::vector<arrow::io::ReadRange> ranges, int64_t hole_size_limit)
+{
+    std::sort(ranges.begin(), ranges.end(), [](const arrow::io::ReadRange &a, const arrow::io::ReadRange &b)
+              { return a.offset < b.offset; });
 
-        // column_orders is optional
-        if (metadata.column_orders_offsets.size() == 0)
+    std::vector<arrow::io::ReadRange> coalesced;
+    for (const auto &range : ranges)
+    {
+        if (!coalesced.empty() && range.offset <= coalesced.back().offset + coalesced.back().length + hole_size_limit)
         {
-            metadata.column_orders_offsets.resize(data_header.get_column_orders_offsets_size());
+            auto end = std::max(coalesced.back().offset + coalesced.back().length, range.offset + range.length);
+            coalesced.back().length = end - coalesced.back().offset;
         }
-
-        if (data_header.get_column_orders_offsets_size() != metadata.column_orders_offsets.size())
+        else
         {
-            auto msg = std::string("Column orders offsets information is invalid, columns=") + std::to_string(data_header.columns) + ", column_orders_offsets=" + std::to_string(metadata.column_orders_offsets.size()) + " !";
-
-            throw std::logic_error(msg);
+            coalesced.push_back(range);
         }
+    }
+
+    return coalesced;
+}
+
+// Reads coalesced ranges of a file and serves the data of the original ranges from them
+class RangeBuffers
+{
+    std::vector<arrow::io::ReadRange> ranges;
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
 
-        for (const auto &row_group : metadata.row_groups)
+public:
+    RangeBuffers(arrow::io::RandomAccessFile *infile, const char *path, const std::vector<arrow::io::ReadRange> &requested_ranges)
+        : ranges(CoalesceReadRanges(requested_ranges, kRangeReadHoleSizeLimit))
+    {
+        buffers.reserve(ranges.size());
+        for (const auto &range : ranges)
         {
-            if (data_header.get_column_chunks_offsets_size() / metadata.row_groups.size() != row_group.column_chunks_offsets.size())
+            std::shared_ptr<arrow::Buffer> buffer;
+            PARQUET_ASSIGN_OR_THROW(buffer, infile->ReadAt(range.offset, range.length));
+            if (buffer->size() != range.length)
             {
-                auto msg = std::string("Column chunk offsets information is invalid, columns=") + std::to_string(data_header.columns) + ", column_chunks_offsets=" + std::to_string(row_group.column_chunks_offsets.size()) + " !";
-
+                auto msg = std::string("I/O error when reading '") + path + "'";
                 throw std::logic_error(msg);
             }
+
+            buffers.emplace_back(std::move(buffer));
         }
     }
 
-    auto total_size = sizeof(data_header) + data_header.get_body_size();
-    std::shared_ptr<arrow::io::BufferOutputStream> fs;
-    PARQUET_ASSIGN_OR_THROW(fs, arrow::io::BufferOutputStream::Create(total_size, arrow::default_memory_pool()));
-
-    PARQUET_THROW_NOT_OK(fs->Write(&data_header, sizeof(data_header)));
-    PARQUET_THROW_NOT_OK(fs->Write(&metadata.num_rows_offsets[0], sizeof(metadata.num_rows_offsets[0]) * metadata.num_rows_offsets.size()));
-    PARQUET_THROW_NOT_OK(fs->Write(&metadata.row_numbers[0], sizeof(metadata.row_numbers[0]) * metadata.row_numbers.size()));
-    PARQUET_THROW_NOT_OK(fs->Write(&metadata.schema_offsets[0], sizeof(metadata.schema_offsets[0]) * metadata.schema_offsets.size()));
-    for (const auto &schema_element : metadata.schema)
+    const uint8_t *GetData(int64_t offset, int64_t length) const
     {
-        PARQUET_THROW_NOT_OK(fs->Write(&schema_element.num_children_offsets[0], sizeof(schema_element.num_children_offsets[0]) * schema_element.num_children_offsets.size()));
-    }
+        // Find the last range starting at or before offset
+        auto range = std::upper_bound(ranges.begin(), ranges.end(), offset, [](int64_t offset, const arrow::io::ReadRange &r)
+                                      { return offset < r.offset; });
+        if (range != ranges.begin() && offset + length <= std::prev(range)->offset + std::prev(range)->length)
+        {
+            --range;
+            return buffers[range - ranges.begin()]->data() + (offset - range->offset);
+        }
 
-    PARQUET_THROW_NOT_OK(fs->Write(&metadata.row_groups_offsets[0], sizeof(metadata.row_groups_offsets[0]) * metadata.row_groups_offsets.size()));
-    PARQUET_THROW_NOT_OK(fs->Write(&metadata.column_orders_offsets[0], sizeof(metadata.column_orders_offsets[0]) * metadata.column_orders_offsets.size()));
-    for (const auto &row_group : metadata.row_groups)
-    {
-        PARQUET_THROW_NOT_OK(fs->Write(&row_group.column_chunks_offsets[0], sizeof(row_group.column_chunks_offsets[0]) * row_group.column_chunks_offsets.size()));
+        auto msg = std::string("Internal error, range offset=") + std::to_string(offset) + ", length=" + std::to_string(length) + " was not read!";
+        throw std::logic_error(msg);
     }
 
-    uint32_t written_column_names_length = 0;
-    for (uint32_t c = 1; c <= data_header.columns; c++)
+    std::vector<MetadataBlock> GetMetadataBlocks(int64_t metadata_offset) const
     {
-        auto name = metadata.schema[c].name;
-        auto cname = name.c_str();
-        auto to_write = name.length() + 1;
-        PARQUET_THROW_NOT_OK(fs->Write(cname, to_write));
-        written_column_names_length += to_write;
-    }
+        std::vector<MetadataBlock> blocks;
+        blocks.reserve(ranges.size());
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            blocks.push_back({static_cast<size_t>(ranges[i].offset - metadata_offset), buffers[i]->data(), static_cast<size_t>(ranges[i].length)});
+        }
 
-    if (data_header.column_names_length != written_column_names_length)
-    {
-        throw std::logic_error("Error when writing the index file, data_header.column_names_length != written_column_names_length !");
+        return blocks;
     }
+};
 
-    PARQUET_THROW_NOT_OK(fs->Write(thrift_buffer->data(), thrift_buffer->size()));
-
-    std::shared_ptr<arrow::Buffer> result;
-    PARQUET_ASSIGN_OR_THROW(result, fs->Finish());
-    if (total_size != static_cast<size_t>(result->size()))
-    {
-        auto msg = std::string("Error when writing the index file, expected size=") + std::to_string(total_size) + ", actual size=" + std::to_string(result->size()) + " !";
-        throw std::logic_error(msg);
-    }
+const uint8_t STATISTICS_HAS_MIN_MAX = 1;
+const uint8_t STATISTICS_HAS_NULL_COUNT = 2;
 
-    return result;
-}
+// The thrift ConvertedType and LogicalType values the statistics depend on, LogicalType values are the field ids of its union
+const int32_t CONVERTED_TYPE_UTF8 = 0;
+const int32_t CONVERTED_TYPE_MAP = 1;
+const int32_t CONVERTED_TYPE_MAP_KEY_VALUE = 2;
+const int32_t CONVERTED_TYPE_ENUM = 4;
+const int32_t CONVERTED_TYPE_UINT_8 = 11;
+const int32_t CONVERTED_TYPE_UINT_64 = 14;
+const int32_t CONVERTED_TYPE_JSON = 19;
+const int32_t CONVERTED_TYPE_BSON = 20;
+const int16_t LOGICAL_TYPE_STRING = 1;
+const int16_t LOGICAL_TYPE_MAP = 2;
+const int16_t LOGICAL_TYPE_ENUM = 4;
+const int16_t LOGICAL_TYPE_INTEGER = 10;
+const int16_t LOGICAL_TYPE_JSON = 12;
+const int16_t LOGICAL_TYPE_BSON = 13;
+const int16_t LOGICAL_TYPE_UUID = 14;
 
-void GenerateMetadataIndex(const char *parquet_path, const char *index_file_path)
+// The parts of a SchemaElement that decide how its statistics are ordered
+struct SchemaElementType
 {
-    auto buffer = GenerateMetadataIndex(parquet_path);
-    std::shared_ptr<arrow::io::FileOutputStream> outfile;
-    PARQUET_ASSIGN_OR_THROW(outfile, arrow::io::FileOutputStream::Open(std::string(index_file_path)));
-    PARQUET_THROW_NOT_OK(outfile->Write(buffer->data(), buffer->size()));
-    PARQUET_THROW_NOT_OK(outfile->Close());
-}
+    int32_t type = -1;           //> 1: optional Type type;
+    int32_t converted_type = -1; //> 6: optional ConvertedType converted_type;
+    int16_t logical_type = 0;    //> 10: optional LogicalType logicalType; (the field id of the union, 0 if not set)
+    bool is_signed = true;       // IntType.isSigned of an INTEGER logical type
+};
 
-std::shared_ptr<parquet::FileMetaData> ReadMetadata(const DataHeader &dataHeader,
-                                                    const uint8_t *data_body,
-                                                    size_t body_size,
-                                                    const std::vector<uint32_t> &row_groups,
-                                                    const std::vector<uint32_t> &column_indices,
-                                                    const std::vector<std::string> &column_names,
-                                                    bool schema_only)
+// Binaries are only stored for the types ordered by their unsigned bytes, decimals, intervals, float16 and the
+// types that came after it are compared differently (or not at all)
+inline palletjack::StatisticsType GetStatisticsType(const SchemaElementType &element)
 {
-    if (memcmp(HEADER_V1, dataHeader.header, HEADER_V1_LENGTH) != 0)
-    {
-        auto msg = std::string("Index file has unexpected format!");
-        throw std::logic_error(msg);
-    }
-
-    if (row_groups.size() > 0)
+    using palletjack::StatisticsType;
+    auto is_unsigned = element.logical_type != 0 ? element.logical_type == LOGICAL_TYPE_INTEGER && !element.is_signed
+                                                 : element.converted_type >= CONVERTED_TYPE_UINT_8 && element.converted_type <= CONVERTED_TYPE_UINT_64;
+    switch (element.type)
     {
-        for (auto row_group : row_groups)
+    case parquet::Type::BOOLEAN:
+        return StatisticsType::Int64;
+    case parquet::Type::INT32:
+    case parquet::Type::INT64:
+        return is_unsigned ? StatisticsType::UInt64 : StatisticsType::Int64;
+    case parquet::Type::FLOAT:
+    case parquet::Type::DOUBLE:
+        return StatisticsType::Double;
+    case parquet::Type::BYTE_ARRAY:
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY:
+        switch (element.logical_type)
         {
-            if (row_group >= dataHeader.row_groups)
+        case 0:
+            switch (element.converted_type)
             {
-                auto msg = std::string("Requested row_group=") + std::to_string(row_group) + ", but only 0-" + std::to_string(dataHeader.row_groups - 1) + " are available!";
-                throw std::logic_error(msg);
+            case -1:
+            case CONVERTED_TYPE_UTF8:
+            case CONVERTED_TYPE_ENUM:
+            case CONVERTED_TYPE_JSON:
+            case CONVERTED_TYPE_BSON:
+                return StatisticsType::BytesPrefix;
+            default:
+                return StatisticsType::None;
             }
+        case LOGICAL_TYPE_STRING:
+        case LOGICAL_TYPE_ENUM:
+        case LOGICAL_TYPE_JSON:
+        case LOGICAL_TYPE_BSON:
+        case LOGICAL_TYPE_UUID:
+            return StatisticsType::BytesPrefix;
+        default:
+            return StatisticsType::None;
         }
+    default:
+        // INT96 has no defined order
+        return StatisticsType::None;
     }
+}
 
-    if (column_indices.size() > 0)
+// Encodes a plain-encoded Statistics min_value or max_value as the 8 bytes stored in the index,
+// returns false for the values that can't be used for comparisons
+inline bool EncodeStatisticsValue(palletjack::StatisticsType statistics_type, int32_t physical_type, std::string_view value, uint64_t &encoded)
+{
+    using palletjack::StatisticsType;
+    switch (statistics_type)
     {
-        if (column_names.size() > 0)
+    case StatisticsType::Int64:
+    case StatisticsType::UInt64:
+        if (physical_type == parquet::Type::BOOLEAN && value.size() == 1)
         {
-            auto msg = std::string("Cannot specify both column indices and column names at the same time!");
-            throw std::logic_error(msg);
+            encoded = value[0] != 0;
         }
-
-        for (auto column : column_indices)
+        else if (physical_type == parquet::Type::INT32 && value.size() == sizeof(int32_t))
         {
-            if (column >= dataHeader.columns)
-            {
-                auto msg = std::string("Requested column=") + std::to_string(column) + ", but only 0-" + std::to_string(dataHeader.columns - 1) + " are available!";
-                throw std::logic_error(msg);
-            }
+            auto int32 = arrow::util::SafeLoadAs<int32_t>(reinterpret_cast<const uint8_t *>(value.data()));
+            encoded = statistics_type == StatisticsType::Int64 ? static_cast<uint64_t>(int64_t(int32)) : uint64_t(uint32_t(int32));
+        }
+        else if (physical_type == parquet::Type::INT64 && value.size() == sizeof(int64_t))
+        {
+            encoded = arrow::util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t *>(value.data()));
+        }
+        else
+        {
+            return false;
         }
+        return true;
+    case StatisticsType::Double:
+    {
+        double number;
+        if (physical_type == parquet::Type::FLOAT && value.size() == sizeof(float))
+            number = arrow::util::SafeLoadAs<float>(reinterpret_cast<const uint8_t *>(value.data()));
+        else if (physical_type == parquet::Type::DOUBLE && value.size() == sizeof(double))
+            number = arrow::util::SafeLoadAs<double>(reinterpret_cast<const uint8_t *>(value.data()));
+        else
+            return false;
+
+        if (std::isnan(number))
+            return false;
+        encoded = std::bit_cast<uint64_t>(number);
+        return true;
+    }
+    case StatisticsType::BytesPrefix:
+        encoded = 0;
+        for (size_t i = 0; i < value.size() && i < sizeof(uint64_t); i++)
+            encoded |= uint64_t(uint8_t(value[i])) << (56 - 8 * i);
+        return true;
+    default:
+        return false;
     }
+}
 
-    auto num_row_offsets = (uint32_t *)&data_body[0];
-    auto row_numbers = (uint32_t *)&num_row_offsets[dataHeader.get_num_rows_offsets_size()];
-    auto schema_offsets = (uint32_t *)&row_numbers[dataHeader.get_row_numbers_size()];
-    auto schema_num_children_offsets = (uint32_t *)&schema_offsets[dataHeader.get_schema_offsets_size()];
-    auto row_groups_offsets = (uint32_t *)&schema_num_children_offsets[dataHeader.get_schema_num_children_offsets_size()];
-    auto column_orders_offsets = (uint32_t *)&row_groups_offsets[dataHeader.get_row_groups_offsets_size()];
-    auto column_chunks_offsets = (uint32_t *)&column_orders_offsets[dataHeader.get_column_orders_offsets_size()];
-    auto column_names_ptr = (uint8_t *)&column_chunks_offsets[dataHeader.get_column_chunks_offsets_size()];
-    auto src = (uint8_t *)&column_names_ptr[dataHeader.column_names_length];
-    ThriftCopier thriftCopier(src, dataHeader.metadata_length);
+// Offsets captured from the thrift FileMetaData, these are the tables stored in the index
+struct MetadataOffsets
+{
+    std::vector<uint32_t> num_rows_offsets;            // 2
+    std::vector<int64_t> row_numbers;                  // rg
+    std::vector<uint32_t> schema_offsets;              // 1 + 1 + e + 1, e schema elements besides the root
+    std::vector<uint32_t> schema_num_children_offsets; // (e + 1) * (1 + 1), relative to the schema element
+    std::vector<int32_t> schema_num_children;          // e + 1, -1 for the leaves
+    std::vector<bool> schema_map_groups;               // e + 1, the groups annotated MAP or MAP_KEY_VALUE
+    std::vector<std::string_view> schema_names;        // e + 1, pointing into the metadata
+    uint32_t schema_leaves = 0;
+    std::vector<uint32_t> row_groups_offsets;          // 1 + rg + 1
+    std::vector<uint32_t> column_chunks_offsets;       // rg * (1 + c + 1), relative to the row group
+    std::vector<uint32_t> column_chunks_offsets_sizes; // rg
+    std::vector<uint32_t> column_orders_offsets;       // 1 + c + 1, empty if the metadata has no column orders
+    std::vector<bool> type_defined_orders;             // c, the ColumnOrder is TYPE_ORDER
+    bool encryption_algorithm = false;
+    std::vector<SchemaElementType> leaf_types;         // c
 
-    uint32_t index_src = 0;
-    size_t toCopy = 0;
+    // Statistics of the column chunks, only scanned with scan_statistics
+    bool scan_statistics = false;
+    std::vector<palletjack::StatisticsType> statistics_types; // c, from leaf_types
+    std::vector<uint8_t> statistics_flags;                    // rg * c, STATISTICS_HAS_* bits
+    std::vector<uint64_t> statistics_min;                     // rg * c, encoded by statistics_types
+    std::vector<uint64_t> statistics_max;                     // rg * c
+    std::vector<int64_t> statistics_null_counts;              // rg * c
 
-    std::vector<uint32_t> columns = column_indices;
-    if (column_names.size() > 0)
-    {
-        columns.reserve(column_names.size());
+    // First sorting column of every row group, only scanned with scan_sorting_columns
+    bool scan_sorting_columns = false;
+    std::vector<int32_t> sorting_columns;  // rg, -1 for row groups without sorting columns
+    std::vector<bool> sorting_descending;  // rg
 
-        std::unordered_map<std::string, uint32_t> columns_map;
-        for (uint32_t c = 0; c < dataHeader.columns; c++)
-        {
-            std::string s = (const char *)column_names_ptr;
-            column_names_ptr += s.length() + 1;
-            columns_map[s] = c;
-        }
+    // Range of the strippable ColumnMetaData fields of every column chunk, only scanned with scan_strip_ranges
+    bool scan_strip_ranges = false;
+    std::vector<uint32_t> strip_ranges; // rg * c * 2, begin and end relative to the column chunk
+};
 
-        if (column_names_ptr != src)
-        {
-            auto msg = std::string("Internal error, when reading column names!");
-            throw std::logic_error(msg);
-        }
+// Walks the thrift compact protocol encoding of FileMetaData and records the offsets that the index needs,
+// everything else is skipped without being decoded, so nothing is allocated per column chunk or per string
+class ThriftOffsetScanner
+{
+    using enum thrift_compact::Type;
 
-        for (const auto &column_name : column_names)
-        {
-            auto kvp = columns_map.find(column_name);
-            if (kvp == columns_map.end())
-            {
-                auto msg = std::string("Couldn't find a column with a name '") + column_name + "'!";
-                throw std::logic_error(msg);
-            }
+    static constexpr int kMaxDepth = 64; // Same as thrift's default recursion limit
 
-            columns.emplace_back(kvp->second);
-        }
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t pos = 0;
+    int depth = 0;
+    MetadataOffsets &offsets;
+
+    [[noreturn]] static void ThrowInvalid(const char *reason)
+    {
+        throw parquet::ParquetException(std::string("Couldn't deserialize thrift: ") + reason + "\n");
     }
 
-    if (columns.size() > 0)
+    void Skip(uint64_t length)
     {
-        //> 2:required list<SchemaElement> schema;
-        auto schema_list = &schema_offsets[0];
-        toCopy = schema_list[0] - index_src;
-        thriftCopier.CopyFrom(index_src, toCopy);
-        index_src += toCopy;
-
-        thriftCopier.WriteListBegin(::apache::thrift::protocol::T_STRUCT, columns.size() + 1); // one extra schema element for root
-        index_src = schema_list[1]; // skip the list header and jump to the first schema element (which is the root element)
-
-        auto root_schema_element = &schema_list[1];
-        toCopy = root_schema_element[0] + schema_num_children_offsets[0] - index_src;
-        thriftCopier.CopyFrom(index_src, toCopy);
+        if (length > size - pos)
+            ThrowInvalid("No more data to read.");
+        pos += length;
+    }
 
-        // Write updated num children in the root element
-        //> 5: optional i32 num_children; 
-        thriftCopier.WriteI32(columns.size());
-        index_src = root_schema_element[0] + schema_num_children_offsets[1];
-        toCopy = root_schema_element[1] - index_src;
-        thriftCopier.CopyFrom(index_src, toCopy);
-        index_src += toCopy;
+    uint8_t ReadByte()
+    {
+        if (pos >= size)
+            ThrowInvalid("No more data to read.");
+        return data[pos++];
+    }
 
-        auto schema_elements = &schema_offsets[2];
-        for (auto column : columns)
+    uint64_t ReadVarint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
         {
-            toCopy = schema_elements[column + 1] - schema_elements[column];
-            thriftCopier.CopyFrom(schema_elements[column], toCopy);
+            auto byte = ReadByte();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
         }
 
-        index_src = schema_elements[dataHeader.columns];
+        ThrowInvalid("Variable-length int over 10 bytes.");
     }
 
-    auto row_group_filtering = row_groups.size() > 0 || schema_only;
-    if (row_group_filtering)
+    int64_t ReadZigzag()
     {
-        //> 3: required i64 num_rows
-        int64_t num_rows = 0;
-        for (auto row_group : row_groups)
-        {
-            num_rows += row_numbers[row_group];
-        }
+        auto value = ReadVarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
 
-        toCopy = num_row_offsets[0] - index_src;
-        thriftCopier.CopyFrom(index_src, toCopy);
-        index_src += toCopy;
+    // Returns false at the end of the struct
+    bool ReadFieldBegin(int16_t &last_field_id, uint8_t &type, int16_t &field_id)
+    {
+        auto byte = ReadByte();
+        type = byte & 0x0f;
+        if (type == CT_STOP)
+            return false;
 
-        thriftCopier.WriteI64(num_rows);
-        index_src = num_row_offsets[1];
+        auto delta = byte >> 4;
+        field_id = delta != 0 ? last_field_id + delta : static_cast<int16_t>(ReadZigzag());
+        last_field_id = field_id;
+        return true;
     }
 
-    if (row_group_filtering)
+    uint32_t ReadListBegin(uint8_t &element_type)
     {
-        //> 4: required list<RowGroup> row_groups
-        auto row_groups_list = &row_groups_offsets[0];
-        toCopy = row_groups_list[0] - index_src;
-        thriftCopier.CopyFrom(index_src, toCopy);
-        index_src += toCopy;
+        auto byte = ReadByte();
+        element_type = byte & 0x0f;
+        uint64_t list_size = byte >> 4;
+        if (list_size == 15)
+            list_size = ReadVarint();
 
-        thriftCopier.WriteListBegin(::apache::thrift::protocol::T_STRUCT, row_groups.size());
-        index_src = row_groups_list[1];
+        // Every element takes at least one byte
+        if (list_size > kDefaultThriftContainerSizeLimit || list_size > size - pos)
+            ThrowInvalid(list_size > kDefaultThriftContainerSizeLimit ? "Exceeded container size limit" : "No more data to read.");
+
+        return list_size;
     }
-    else
+
+    std::string_view ReadBinary()
     {
-        // Copy to here, including the list header
-        auto row_groups_list = &row_groups_offsets[0];
-        toCopy = row_groups_list[1] - index_src;
-        thriftCopier.CopyFrom(index_src, toCopy);
-        index_src += toCopy;
+        auto length = ReadVarint();
+        if (length > kDefaultThriftStringSizeLimit)
+            ThrowInvalid("Exceeded string size limit");
+
+        auto start = pos;
+        Skip(length);
+        return std::string_view((const char *)&data[start], length);
     }
 
-    for (auto idx = 0u;; idx++)
+    void Enter()
     {
-        size_t row_group_idx = 0;
+        if (++depth > kMaxDepth)
+            ThrowInvalid("Depth limit exceeded");
+    }
 
-        if (row_group_filtering)
+    void Leave() { depth--; }
+
+    // A bool field keeps its value in the field header, while a bool in a collection takes one byte
+    void SkipValue(uint8_t type, bool is_field = true)
+    {
+        switch (type)
         {
-            if (idx >= row_groups.size())
+        case CT_BOOLEAN_TRUE:
+        case CT_BOOLEAN_FALSE:
+            if (!is_field)
+                Skip(1);
+            break;
+        case CT_BYTE:
+            Skip(1);
+            break;
+        case CT_I16:
+        case CT_I32:
+        case CT_I64:
+            ReadVarint();
+            break;
+        case CT_DOUBLE:
+            Skip(8);
+            break;
+        case CT_BINARY:
+            ReadBinary();
+            break;
+        case CT_UUID:
+            Skip(16);
+            break;
+        case CT_LIST:
+        case CT_SET:
+        {
+            uint8_t element_type;
+            auto list_size = ReadListBegin(element_type);
+            Enter();
+            for (uint32_t i = 0; i < list_size; i++)
+                SkipValue(element_type, false);
+            Leave();
+            break;
+        }
+        case CT_MAP:
+        {
+            auto map_size = ReadVarint();
+            if (map_size > kDefaultThriftContainerSizeLimit)
+                ThrowInvalid("Exceeded container size limit");
+            if (map_size == 0)
                 break;
 
-            row_group_idx = row_groups[idx];
+            auto types = ReadByte();
+            Enter();
+            for (uint64_t i = 0; i < map_size; i++)
+            {
+                SkipValue(types >> 4, false);
+                SkipValue(types & 0x0f, false);
+            }
+            Leave();
+            break;
         }
-        else
+        case CT_STRUCT:
+            SkipStruct();
+            break;
+        default:
+            ThrowInvalid("Invalid data");
+        }
+    }
+
+    void SkipStruct()
+    {
+        Enter();
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
+            SkipValue(type);
+        Leave();
+    }
+
+    void ScanSchemaElement()
+    {
+        Enter();
+        auto start = pos;
+        uint32_t num_children_begin = 0;
+        uint32_t num_children_end = 0;
+        int32_t num_children = -1;
+        std::string_view name;
+        SchemaElementType element_type;
+        bool has_num_children = false;
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
         {
-            if (idx >= dataHeader.row_groups)
-                break;
+            if (field_id == 1 && type == CT_I32)
+            {
+                //> 1: optional Type type;
+                element_type.type = static_cast<int32_t>(ReadZigzag());
+            }
+            else if (field_id == 4 && type == CT_BINARY)
+            {
+                //> 4: required string name;
+                name = ReadBinary();
+            }
+            else if (field_id == 5 && type == CT_I32)
+            {
+                //> 5: optional i32 num_children;
+                num_children_begin = pos - start;
+                num_children = static_cast<int32_t>(ReadZigzag());
+                num_children_end = pos - start;
+                has_num_children = true;
+            }
+            else if (field_id == 6 && type == CT_I32)
+            {
+                //> 6: optional ConvertedType converted_type;
+                element_type.converted_type = static_cast<int32_t>(ReadZigzag());
+            }
+            else if (field_id == 10 && type == CT_STRUCT)
+            {
+                //> 10: optional LogicalType logicalType;
+                ScanLogicalType(element_type);
+            }
+            else
+            {
+                SkipValue(type);
+            }
+        }
+        Leave();
 
-            row_group_idx = idx;
+        offsets.schema_num_children_offsets.push_back(num_children_begin);
+        offsets.schema_num_children_offsets.push_back(num_children_end);
+        offsets.schema_num_children.push_back(has_num_children ? num_children : -1);
+        offsets.schema_map_groups.push_back(has_num_children && (element_type.logical_type == LOGICAL_TYPE_MAP ||
+                                                                 element_type.converted_type == CONVERTED_TYPE_MAP ||
+                                                                 element_type.converted_type == CONVERTED_TYPE_MAP_KEY_VALUE));
+        offsets.schema_names.push_back(name);
+        // Leaves are the schema elements without children, the first element is the root
+        if (!has_num_children && offsets.schema_names.size() > 1)
+        {
+            offsets.schema_leaves++;
+            offsets.leaf_types.push_back(element_type);
         }
+    }
 
-        auto row_group_offset = row_groups_offsets[1 + row_group_idx];
-        index_src = row_groups_offsets[1 + row_group_idx];
-        if (columns.size() > 0)
+    void ScanLogicalType(SchemaElementType &element_type)
+    {
+        Enter();
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
         {
-            //> 1: required list<ColumnChunk> columns
-            auto chunks_list = &column_chunks_offsets[(1 + dataHeader.columns + 1) * row_group_idx];
-            auto chunks = &chunks_list[1];
-            toCopy = row_group_offset + chunks_list[0] - index_src;
-            thriftCopier.CopyFrom(index_src, toCopy);
-            thriftCopier.WriteListBegin(::apache::thrift::protocol::T_STRUCT, columns.size());
+            element_type.logical_type = field_id;
+            if (field_id == LOGICAL_TYPE_INTEGER && type == CT_STRUCT)
+            {
+                //> 10: IntType INTEGER
+                Enter();
+                int16_t int_last_field_id = 0;
+                while (ReadFieldBegin(int_last_field_id, type, field_id))
+                {
+                    //> 2: required bool isSigned;
+                    if (field_id == 2 && (type == CT_BOOLEAN_TRUE || type == CT_BOOLEAN_FALSE))
+                        element_type.is_signed = type == CT_BOOLEAN_TRUE;
+                    else
+                        SkipValue(type);
+                }
+                Leave();
+            }
+            else
+            {
+                SkipValue(type);
+            }
+        }
+        Leave();
+    }
+
+    void ScanColumnOrder()
+    {
+        Enter();
+        bool type_defined_order = false;
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
+        {
+            //> 1: TypeDefinedOrder TYPE_ORDER;
+            type_defined_order |= field_id == 1;
+            SkipValue(type);
+        }
+        Leave();
+
+        offsets.type_defined_orders.push_back(type_defined_order);
+    }
 
-            for (auto column_to_copy : columns)
+    // entry is the (row group, column) position in the statistics tables
+    void ScanStatistics(size_t entry, size_t column)
+    {
+        Enter();
+        std::string_view min_value;
+        std::string_view max_value;
+        bool has_min_value = false;
+        bool has_max_value = false;
+        uint8_t flags = 0;
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
+        {
+            if (field_id == 3 && type == CT_I64)
+            {
+                //> 3: optional i64 null_count;
+                offsets.statistics_null_counts[entry] = ReadZigzag();
+                flags |= STATISTICS_HAS_NULL_COUNT;
+            }
+            else if (field_id == 5 && type == CT_BINARY)
             {
-                toCopy = chunks[column_to_copy + 1] - chunks[column_to_copy];
-                thriftCopier.CopyFrom(row_group_offset + chunks[column_to_copy], toCopy);
+                //> 5: optional binary max_value;
+                max_value = ReadBinary();
+                has_max_value = true;
             }
+            else if (field_id == 6 && type == CT_BINARY)
+            {
+                //> 6: optional binary min_value;
+                min_value = ReadBinary();
+                has_min_value = true;
+            }
+            else
+            {
+                // The deprecated min and max (1, 2) are sorted as signed bytes, so they are left out
+                SkipValue(type);
+            }
+        }
+        Leave();
 
-            index_src = row_group_offset + chunks[dataHeader.columns];
-            toCopy = row_groups_offsets[1 + row_group_idx + 1] - index_src;
-            thriftCopier.CopyFrom(index_src, toCopy);
-            index_src += toCopy;
+        auto statistics_type = offsets.statistics_types[column];
+        auto physical_type = offsets.leaf_types[column].type;
+        if (has_min_value && has_max_value &&
+            EncodeStatisticsValue(statistics_type, physical_type, min_value, offsets.statistics_min[entry]) &&
+            EncodeStatisticsValue(statistics_type, physical_type, max_value, offsets.statistics_max[entry]))
+        {
+            flags |= STATISTICS_HAS_MIN_MAX;
         }
-        else
+
+        offsets.statistics_flags[entry] = flags;
+    }
+
+    // The ColumnMetaData fields a read with strip leaves out:
+    //> 12: optional Statistics statistics;
+    //> 13: optional list<PageEncodingStats> encoding_stats;
+    //> 14: optional i64 bloom_filter_offset;
+    //> 15: optional i32 bloom_filter_length;
+    //> 16: optional SizeStatistics size_statistics;
+    //> 17: optional GeospatialStatistics geospatial_statistics;
+    static bool IsStrippableField(int16_t field_id) { return field_id >= 12 && field_id <= 17; }
+
+    void ScanColumnChunk(size_t entry, size_t column)
+    {
+        auto chunk_start = pos;
+        Enter();
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
         {
-            toCopy = row_groups_offsets[1 + row_group_idx + 1] - index_src;
-            thriftCopier.CopyFrom(index_src, toCopy);
-            index_src += toCopy;
+            if (field_id == 3 && type == CT_STRUCT)
+            {
+                //> 3: optional ColumnMetaData meta_data
+                Enter();
+                uint32_t strip_begin = 0;
+                uint32_t strip_end = 0;
+                bool strippable = true;
+                int16_t meta_data_last_field_id = 0;
+                auto field_begin = pos;
+                while (ReadFieldBegin(meta_data_last_field_id, type, field_id))
+                {
+                    if (field_id == 12 && type == CT_STRUCT && offsets.scan_statistics)
+                        ScanStatistics(entry, column);
+                    else
+                        SkipValue(type);
+
+                    // The stripped fields have to be the last ones, a field after them would need its header re-encoded
+                    if (IsStrippableField(field_id))
+                    {
+                        strip_begin = strip_begin == 0 ? field_begin - chunk_start : strip_begin;
+                        strip_end = pos - chunk_start;
+                    }
+                    else
+                    {
+                        strippable &= strip_begin == 0;
+                    }
+
+                    field_begin = pos;
+                }
+                Leave();
+
+                if (offsets.scan_strip_ranges && strippable)
+                {
+                    offsets.strip_ranges[2 * entry] = strip_begin;
+                    offsets.strip_ranges[2 * entry + 1] = strip_end;
+                }
+            }
+            else
+            {
+                SkipValue(type);
+            }
         }
+        Leave();
     }
 
-    index_src = row_groups_offsets[1 + dataHeader.row_groups];
+    void ScanSortingColumns()
+    {
+        uint8_t element_type;
+        auto list_size = ReadListBegin(element_type);
+        for (uint32_t i = 0; i < list_size; i++)
+        {
+            // Only the first sorting column orders the row groups
+            if (i > 0 || element_type != CT_STRUCT)
+            {
+                SkipValue(element_type, false);
+                continue;
+            }
 
-    if (columns.size() > 0)
+            Enter();
+            int16_t last_field_id = 0;
+            uint8_t type;
+            int16_t field_id;
+            while (ReadFieldBegin(last_field_id, type, field_id))
+            {
+                if (field_id == 1 && type == CT_I32)
+                {
+                    //> 1: required i32 column_idx
+                    offsets.sorting_columns.back() = ReadZigzag();
+                }
+                else if (field_id == 2 && (type == CT_BOOLEAN_TRUE || type == CT_BOOLEAN_FALSE))
+                {
+                    //> 2: required bool descending
+                    offsets.sorting_descending.back() = type == CT_BOOLEAN_TRUE;
+                }
+                else
+                {
+                    SkipValue(type);
+                }
+            }
+            Leave();
+        }
+    }
+
+    void ScanRowGroup()
     {
-        //> 7: optional list<ColumnOrder> column_orders;
-        if (column_orders_offsets[0] != 0)
+        Enter();
+        if (offsets.scan_sorting_columns)
         {
-            auto column_orders_list = &column_orders_offsets[0];
-            toCopy = column_orders_list[0] - index_src;
-            thriftCopier.CopyFrom(index_src, toCopy);
-            index_src += toCopy;
+            offsets.sorting_columns.push_back(-1);
+            offsets.sorting_descending.push_back(false);
+        }
 
-            thriftCopier.WriteListBegin(::apache::thrift::protocol::T_STRUCT, columns.size()); // one extra element for root
-            index_src = column_orders_list[1];
+        auto start = pos;
+        auto column_chunks_offsets_size = offsets.column_chunks_offsets.size();
+        // The leaf types come from the schema, which writers put before the row groups
+        auto scanned_columns = offsets.scan_statistics || offsets.scan_strip_ranges ? offsets.leaf_types.size() : 0;
+        auto scanned_offset = offsets.column_chunks_offsets_sizes.size() * scanned_columns;
+        if (offsets.scan_statistics)
+        {
+            offsets.statistics_flags.resize(scanned_offset + scanned_columns);
+            offsets.statistics_min.resize(scanned_offset + scanned_columns);
+            offsets.statistics_max.resize(scanned_offset + scanned_columns);
+            offsets.statistics_null_counts.resize(scanned_offset + scanned_columns);
+        }
 
-            auto column_orders = &column_orders_offsets[1];
-            for (auto column : columns)
+        if (offsets.scan_strip_ranges)
+            offsets.strip_ranges.resize(2 * (scanned_offset + scanned_columns));
+
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
+        {
+            if (field_id == 1 && type == CT_LIST)
             {
-                toCopy = column_orders[column + 1] - column_orders[column];
-                thriftCopier.CopyFrom(column_orders[column], toCopy);
+                //> 1: required list<ColumnChunk> columns
+                offsets.column_chunks_offsets.push_back(pos - start);
+                uint8_t element_type;
+                auto list_size = ReadListBegin(element_type);
+                for (uint32_t i = 0; i < list_size; i++)
+                {
+                    offsets.column_chunks_offsets.push_back(pos - start);
+                    if (i < scanned_columns)
+                        ScanColumnChunk(scanned_offset + i, i);
+                    else
+                        SkipStruct();
+                }
+                offsets.column_chunks_offsets.push_back(pos - start);
+            }
+            else if (field_id == 3 && type == CT_I64)
+            {
+                //> 3: required i64 num_rows
+                offsets.row_numbers.push_back(ReadZigzag());
+            }
+            else if (field_id == 4 && type == CT_LIST && offsets.scan_sorting_columns)
+            {
+                //> 4: optional list<SortingColumn> sorting_columns
+                ScanSortingColumns();
+            }
+            else
+            {
+                SkipValue(type);
             }
-            index_src = column_orders[dataHeader.columns];
         }
+        Leave();
+
+        offsets.column_chunks_offsets_sizes.push_back(offsets.column_chunks_offsets.size() - column_chunks_offsets_size);
     }
 
-    // Copy leftovers
-    toCopy = dataHeader.metadata_length - index_src;
-    thriftCopier.CopyFrom(index_src, toCopy);
+    // Records the offset of the list header, of every element and of the end of the list
+    template <typename TScanElement>
+    void ScanList(std::vector<uint32_t> &list_offsets, TScanElement scan_element)
+    {
+        list_offsets.push_back(pos);
+        uint8_t element_type;
+        auto list_size = ReadListBegin(element_type);
+        for (uint32_t i = 0; i < list_size; i++)
+        {
+            list_offsets.push_back(pos);
+            scan_element();
+        }
+        list_offsets.push_back(pos);
+    }
 
-#ifdef DEBUG
-    std::cerr << " Reading body_size: " << body_size << std::endl;
-    std::cerr << " Reading thrift offset: " << src - &data_body[0] << std::endl;
-    std::cerr << " Reading thrift length: " << dataHeader.metadata_length << std::endl;
-#endif
+public:
+    ThriftOffsetScanner(const uint8_t *data, uint32_t size, MetadataOffsets &offsets) : data(data), size(size), offsets(offsets) {}
 
-    uint32_t length = thriftCopier.GetDataSize();
-    return parquet::FileMetaData::Make(thriftCopier.GetData(), &length);
-}
+    // Scans the schema elements of a schema list, data starts with the first element (the root) instead of the list header
+    void ScanSchemaElements(uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            ScanSchemaElement();
+    }
 
-std::shared_ptr<parquet::FileMetaData> ReadMetadata(const char *index_file_path,
-                                                    const std::vector<uint32_t> &row_groups,
-                                                    const std::vector<uint32_t> &column_indices,
-                                                    const std::vector<std::string> &column_names,
-                                                    bool schema_only)
-{
-    std::shared_ptr<arrow::io::ReadableFile> infile;
-    PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(std::string(index_file_path)));
+    // Finds a key of the key_value_metadata, data starts with the FileMetaData fields that follow the row groups.
+    // value_begin is the offset of the value's length, false if the key isn't there.
+    bool FindKeyValue(std::string_view key, uint32_t &value_begin, std::string_view &value)
+    {
+        Enter();
+        bool found = false;
+        int16_t last_field_id = 4; // The row groups
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
+        {
+            if (field_id != 5 || type != CT_LIST || found)
+            {
+                SkipValue(type);
+                continue;
+            }
 
-    DataHeader dataHeader;
+            //> 5: optional list<KeyValue> key_value_metadata
+            uint8_t element_type;
+            auto list_size = ReadListBegin(element_type);
+            for (uint32_t i = 0; i < list_size; i++)
+            {
+                Enter();
+                bool is_key = false;
+                int16_t key_value_last_field_id = 0;
+                while (ReadFieldBegin(key_value_last_field_id, type, field_id))
+                {
+                    if (field_id == 1 && type == CT_BINARY)
+                    {
+                        //> 1: required string key
+                        is_key = ReadBinary() == key;
+                    }
+                    else if (field_id == 2 && type == CT_BINARY && is_key && !found)
+                    {
+                        //> 2: optional string value
+                        value_begin = pos;
+                        value = ReadBinary();
+                        found = true;
+                    }
+                    else
+                    {
+                        SkipValue(type);
+                    }
+                }
+                Leave();
+            }
+        }
+        Leave();
+
+        return found;
+    }
+
+    void ScanFileMetaData()
     {
-        int64_t n;
-        PARQUET_ASSIGN_OR_THROW(n, infile->Read(sizeof(DataHeader), &dataHeader));
-        if (static_cast<size_t>(n) != sizeof(DataHeader))
+        Enter();
+        int16_t last_field_id = 0;
+        uint8_t type;
+        int16_t field_id;
+        while (ReadFieldBegin(last_field_id, type, field_id))
         {
-            auto msg = std::string("I/O error when reading '") + index_file_path + "'";
-            throw std::logic_error(msg);
+            if (field_id == 2 && type == CT_LIST)
+            {
+                //> 2: required list<SchemaElement> schema;
+                ScanList(offsets.schema_offsets, [this]()
+                         { ScanSchemaElement(); });
+            }
+            else if (field_id == 3 && type == CT_I64)
+            {
+                //> 3: required i64 num_rows
+                offsets.num_rows_offsets.push_back(pos);
+                ReadVarint();
+                offsets.num_rows_offsets.push_back(pos);
+            }
+            else if (field_id == 4 && type == CT_LIST)
+            {
+                //> 4: required list<RowGroup> row_groups
+                if (offsets.scan_statistics)
+                {
+                    offsets.statistics_types.clear();
+                    for (const auto &leaf_type : offsets.leaf_types)
+                        offsets.statistics_types.push_back(GetStatisticsType(leaf_type));
+                }
+
+                ScanList(offsets.row_groups_offsets, [this]()
+                         { ScanRowGroup(); });
+            }
+            else if (field_id == 7 && type == CT_LIST)
+            {
+                //> 7: optional list<ColumnOrder> column_orders;
+                ScanList(offsets.column_orders_offsets, [this]()
+                         { ScanColumnOrder(); });
+            }
+            else if (field_id == 8 && type == CT_STRUCT)
+            {
+                //> 8: optional EncryptionAlgorithm encryption_algorithm
+                offsets.encryption_algorithm = true;
+                SkipStruct();
+            }
+            else
+            {
+                SkipValue(type);
+            }
         }
+        Leave();
+    }
+};
+
+// Reads the thrift FileMetaData bytes from the end of a parquet file, checking the footer the same way parquet::ReadMetaData does.
+// on_metadata_length is called with the length of the metadata before it is read.
+std::shared_ptr<arrow::Buffer> ReadFooter(const char *parquet_path, const std::function<void(uint32_t)> &on_metadata_length = {})
+{
+    std::shared_ptr<arrow::io::ReadableFile> infile;
+    PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(std::string(parquet_path)));
+    int64_t file_size;
+    PARQUET_ASSIGN_OR_THROW(file_size, infile->GetSize());
+    if (file_size == 0)
+    {
+        throw parquet::ParquetInvalidOrCorruptedFileException("Parquet file size is 0 bytes");
+    }
+
+    if (file_size < kFooterSize)
+    {
+        throw parquet::ParquetInvalidOrCorruptedFileException("Parquet file size is ", file_size,
+                                                              " bytes, smaller than the minimum file footer (", kFooterSize, " bytes)");
     }
 
-    if (memcmp(HEADER_V1, dataHeader.header, HEADER_V1_LENGTH) != 0)
+    // Most footers fit in the speculative read, so the file is usually read only once
+    auto tail_length = std::min<int64_t>(file_size, parquet::kDefaultFooterReadSize);
+    std::shared_ptr<arrow::Buffer> tail;
+    PARQUET_ASSIGN_OR_THROW(tail, infile->ReadAt(file_size - tail_length, tail_length));
+    if (tail->size() != tail_length)
     {
-        auto msg = std::string("File '") + index_file_path + "' has unexpected format!";
+        auto msg = std::string("I/O error when reading '") + parquet_path + "'";
         throw std::logic_error(msg);
     }
 
-    auto body_size = dataHeader.get_body_size();
-    std::shared_ptr<arrow::Buffer> body_buffer;
-    PARQUET_ASSIGN_OR_THROW(body_buffer, infile->Read(body_size));
-    if (static_cast<size_t>(body_buffer->size()) != body_size)
+    auto footer = tail->data() + tail_length - kFooterSize;
+    if (memcmp(footer + 4, kParquetEMagic, 4) == 0)
     {
-        auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+        throw parquet::ParquetException("Could not read encrypted metadata, no decryption found in reader's properties");
+    }
+
+    if (memcmp(footer + 4, kParquetMagic, 4) != 0)
+    {
+        throw parquet::ParquetInvalidOrCorruptedFileException(
+            "Parquet magic bytes not found in footer. Either the file is corrupted or this is not a parquet file.");
+    }
+
+    uint32_t metadata_length = arrow::util::SafeLoadAs<uint32_t>(footer);
+    if (metadata_length > file_size - kFooterSize)
+    {
+        throw parquet::ParquetInvalidOrCorruptedFileException("Parquet file size is ", file_size,
+                                                              " bytes, smaller than the size reported by footer's (", metadata_length, " bytes)");
+    }
+
+    if (on_metadata_length)
+    {
+        on_metadata_length(metadata_length);
+    }
+
+    if (metadata_length <= tail_length - kFooterSize)
+    {
+        return arrow::SliceBuffer(tail, tail_length - kFooterSize - metadata_length, metadata_length);
+    }
+
+    std::shared_ptr<arrow::Buffer> metadata_buffer;
+    PARQUET_ASSIGN_OR_THROW(metadata_buffer, infile->ReadAt(file_size - kFooterSize - metadata_length, metadata_length));
+    if (metadata_buffer->size() != metadata_length)
+    {
+        auto msg = std::string("I/O error when reading '") + parquet_path + "'";
         throw std::logic_error(msg);
     }
 
-    return ReadMetadata(dataHeader, body_buffer->data(), body_size, row_groups, column_indices, column_names, schema_only);
+    return metadata_buffer;
 }
 
-std::shared_ptr<parquet::FileMetaData> ReadMetadata(const unsigned char *index_data,
-                                                    size_t index_data_length,
-                                                    const std::vector<uint32_t> &row_groups,
-                                                    const std::vector<uint32_t> &column_indices,
-                                                    const std::vector<std::string> &column_names,
-                                                    bool schema_only)
+// FNV-1a, it is part of the file format, so it must not depend on the platform or the standard library
+inline uint64_t HashColumnName(const char *name, size_t length)
 {
-    if (index_data_length < sizeof(DataHeader))
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++)
     {
-        auto msg = std::string("Index data is too small, length=") + std::to_string(index_data_length);
-        throw std::logic_error(msg);
+        hash ^= static_cast<uint8_t>(name[i]);
+        hash *= 1099511628211ull;
     }
 
-    const DataHeader *p_data_header = (const DataHeader *)index_data;
-    size_t expected_length = sizeof(DataHeader) + p_data_header->get_body_size();
-    if (index_data_length != expected_length)
+    return hash;
+}
+
+// The schema elements of a nested schema as a tree. Element 0 is the root, the others follow in the pre-order of the
+// schema list, and the leaves are the columns in order, so the columns of a group are a contiguous range.
+class SchemaTree
+{
+    std::vector<uint32_t> parents;       // e + 1
+    std::vector<uint32_t> first_columns; // e + 1, the first column of the group of the element
+    std::vector<uint32_t> columns_count; // e + 1
+    std::vector<uint32_t> leaves;        // c, the element of every column
+    std::vector<bool> map_groups;        // e + 1, the groups annotated MAP or MAP_KEY_VALUE
+
+    // The ancestors of a column from the top level element down to its leaf, without the root
+    void GetPath(uint32_t column, std::vector<uint32_t> &path) const
     {
-        auto msg = std::string("Index data has unexpected length, length=") + std::to_string(index_data_length) + ", expected=" + std::to_string(expected_length);
-        throw std::logic_error(msg);
+        path.clear();
+        for (auto element = leaves[column]; element != 0; element = parents[element])
+            path.push_back(element);
+
+        std::reverse(path.begin(), path.end());
     }
 
-    return ReadMetadata(*p_data_header, &index_data[sizeof(DataHeader)], index_data_length - sizeof(DataHeader), row_groups, column_indices, column_names, schema_only);
-}
\ No newline at end of file
+public:
+    // num_children has the num_children of the root and of every element, -1 for the leaves
+    SchemaTree(const std::vector<int32_t> &num_children, const std::vector<bool> &map_groups, uint32_t columns)
+        : parents(num_children.size()),
+          first_columns(num_children.size()),
+          columns_count(num_children.size()),
+          map_groups(map_groups)
+    {
+        // The groups whose children are still to come, with the number of them
+        std::vector<std::pair<uint32_t, int32_t>> open_groups;
+        bool valid = num_children.size() > 0 && num_children[0] >= 0;
+        if (valid)
+            open_groups.emplace_back(0, num_children[0]);
+
+        for (uint32_t element = 1; valid && element < num_children.size(); element++)
+        {
+            while (open_groups.size() > 0 && open_groups.back().second == 0)
+                open_groups.pop_back();
+
+            valid = open_groups.size() > 0 && num_children[element] >= -1;
+            if (!valid)
+                break;
+
+            open_groups.back().second--;
+            parents[element] = open_groups.back().first;
+            first_columns[element] = leaves.size();
+            if (num_children[element] >= 0)
+                open_groups.emplace_back(element, num_children[element]);
+            else
+                leaves.push_back(element);
+        }
+
+        valid = valid && leaves.size() == columns && map_groups.size() == num_children.size() &&
+                std::all_of(open_groups.begin(), open_groups.end(), [](const auto &group)
+                            { return group.second == 0; });
+        if (!valid)
+        {
+            auto msg = std::string("The num_children of the schema elements don't form a tree!");
+            throw std::logic_error(msg);
+        }
+
+        // Children follow their parents, so the groups are counted bottom-up
+        for (auto element = num_children.size() - 1; element > 0; element--)
+        {
+            columns_count[element] += num_children[element] < 0 ? 1 : 0;
+            columns_count[parents[element]] += columns_count[element];
+        }
+    }
+
+    uint32_t GetParent(uint32_t element) const { return parents[element]; }
+
+    // The range of columns of the group of an element, the column itself for a leaf
+    std::pair<uint32_t, uint32_t> GetColumns(uint32_t element) const { return {first_columns[element], first_columns[element] + columns_count[element]}; }
+
+    // Orders columns so the columns of every group are next to each other, with the groups and their columns in the order
+    // they are first selected in. The schema of the columns keeps that order, duplicates are left out.
+    // A column of a map comes with the key of the map, its first column, as readers reject a key_value group without it.
+    std::vector<uint32_t> GroupColumns(const std::vector<uint32_t> &selected_columns) const
+    {
+        std::vector<uint32_t> columns;
+        std::vector<uint32_t> path;
+        for (auto column : selected_columns)
+        {
+            GetPath(column, path);
+            for (auto element : path)
+            {
+                if (map_groups[element] && first_columns[element] != column)
+                    columns.push_back(first_columns[element]);
+            }
+
+            columns.push_back(column);
+        }
+
+        std::unordered_map<uint32_t, uint32_t> ranks;
+        std::vector<std::vector<uint32_t>> keys(columns.size());
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            GetPath(columns[i], path);
+            for (auto element : path)
+                keys[i].push_back(ranks.emplace(element, ranks.size()).first->second);
+        }
+
+        std::vector<size_t> order(columns.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+                         { return keys[a] < keys[b]; });
+
+        std::vector<uint32_t> grouped;
+        grouped.reserve(columns.size());
+        for (auto i : order)
+        {
+            if (grouped.size() == 0 || grouped.back() != columns[i])
+                grouped.push_back(columns[i]);
+        }
+
+        return grouped;
+    }
+
+    // The elements of the schema of grouped columns, starting with the root, and the number of their selected children
+    std::vector<std::pair<uint32_t, uint32_t>> GetSelectedElements(const std::vector<uint32_t> &grouped_columns) const
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> selected = {{0, 0}};
+        std::vector<size_t> open_elements = {0}; // Positions in selected of the path of the last column
+        std::vector<uint32_t> path;
+        for (auto column : grouped_columns)
+        {
+            GetPath(column, path);
+            size_t depth = 0;
+            while (depth < path.size() && depth + 1 < open_elements.size() && selected[open_elements[depth + 1]].first == path[depth])
+                depth++;
+
+            open_elements.resize(depth + 1);
+            for (; depth < path.size(); depth++)
+            {
+                selected[open_elements.back()].second++;
+                open_elements.push_back(selected.size());
+                selected.emplace_back(path[depth], 0);
+            }
+        }
+
+        return selected;
+    }
+
+    // The dotted paths of the elements besides the root, like the paths of parquet's ColumnPath
+    std::vector<std::string> GetPaths(const std::vector<std::string_view> &names) const
+    {
+        std::vector<std::string> paths(parents.size());
+        for (uint32_t element = 1; element < parents.size(); element++)
+        {
+            auto parent = parents[element];
+            paths[element] = parent == 0 ? std::string(names[element]) : paths[parent] + "." + std::string(names[element]);
+        }
+
+        paths.erase(paths.begin());
+        return paths;
+    }
+};
+
+/* Column names hash section (ExtensionSectionId::ColumnNamesHash):
+|       | slots             | (uint32) - Number of hash slots, a power of two
+|       --------------------|
+|       | name offsets      | (uint32[columns]) - Offset of each name in the column names section
+|       --------------------|
+|       | slots             | (uint32[slots]) - Column + 1 of the name hashed to the slot (linear probing), 0 for an empty slot
+*/
+class ColumnNamesHash
+{
+    const char *column_names;
+    uint32_t column_names_length;
+    uint32_t columns;
+    const uint32_t *name_offsets;
+    const uint32_t *slots;
+    uint32_t slots_mask;
+
+public:
+    static std::shared_ptr<arrow::Buffer> Build(const std::vector<std::string_view> &names)
+    {
+        uint32_t slots_count = 2;
+        while (slots_count < 2 * names.size())
+            slots_count *= 2;
+
+        std::vector<uint32_t> section(1 + names.size() + slots_count);
+        section[0] = TO_FILE_ENDIANESS(slots_count);
+        auto name_offsets = &section[1];
+        auto slots = &section[1 + names.size()];
+        uint32_t name_offset = 0;
+        for (uint32_t c = 0; c < names.size(); c++)
+        {
+            name_offsets[c] = TO_FILE_ENDIANESS(name_offset);
+            name_offset += names[c].length() + 1;
+
+            auto slot = HashColumnName(names[c].data(), names[c].length()) & (slots_count - 1);
+            // A duplicate name takes over the slot, so the last column with the name wins (same as the names map)
+            while (slots[slot] != 0 && names[FROM_FILE_ENDIANESS(slots[slot]) - 1] != names[c])
+                slot = (slot + 1) & (slots_count - 1);
+
+            slots[slot] = TO_FILE_ENDIANESS(c + 1);
+        }
+
+        return arrow::Buffer::FromVector(std::move(section));
+    }
+
+    ColumnNamesHash(const DataHeader &dataHeader, const uint8_t *column_names, const uint8_t *section, uint64_t section_length)
+        : column_names((const char *)column_names),
+          column_names_length(dataHeader.column_names_length),
+          columns(dataHeader.get_schema_elements())
+    {
+        auto words = (const uint32_t *)section;
+        uint64_t slots_count = section_length >= sizeof(uint32_t) ? FROM_FILE_ENDIANESS(words[0]) : 0;
+        if (slots_count == 0 || (slots_count & (slots_count - 1)) != 0 ||
+            section_length != (1 + columns + slots_count) * sizeof(uint32_t))
+        {
+            auto msg = std::string("Index column names hash section is invalid!");
+            throw std::logic_error(msg);
+        }
+
+        name_offsets = &words[1];
+        slots = &words[1 + columns];
+        slots_mask = slots_count - 1;
+    }
+
+    std::vector<uint32_t> ResolveColumns(const std::vector<std::string> &names) const
+    {
+        std::vector<uint32_t> result;
+        result.reserve(names.size());
+        for (const auto &name : names)
+        {
+            bool found = false;
+            auto slot = HashColumnName(name.data(), name.length()) & slots_mask;
+            for (uint32_t probes = 0; probes <= slots_mask; probes++, slot = (slot + 1) & slots_mask)
+            {
+                auto column = FROM_FILE_ENDIANESS(slots[slot]);
+                if (column == 0 || column > columns)
+                    break;
+
+                uint64_t name_offset = FROM_FILE_ENDIANESS(name_offsets[column - 1]);
+                if (name_offset + name.length() < column_names_length &&
+                    column_names[name_offset + name.length()] == '\0' &&
+                    memcmp(&column_names[name_offset], name.data(), name.length()) == 0)
+                {
+                    result.emplace_back(column - 1);
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found)
+            {
+                auto msg = std::string("Couldn't find a column with a name '") + name + "'!";
+                throw std::logic_error(msg);
+            }
+        }
+
+        return result;
+    }
+};
+
+constexpr size_t kPackedBlockSize = 32;
+
+// Unpacks kPackedBlockSize values of width bits, words has width + 1 readable words
+void UnpackBlockScalar(const uint32_t *words, uint32_t width, uint32_t *values)
+{
+    uint32_t mask = width == 32 ? ~0u : (1u << width) - 1;
+    for (uint32_t j = 0; j < kPackedBlockSize; j++)
+    {
+        uint32_t bit = j * width;
+        uint64_t pair = FROM_FILE_ENDIANESS(words[bit / 32]) | (uint64_t(FROM_FILE_ENDIANESS(words[bit / 32 + 1])) << 32);
+        values[j] = uint32_t(pair >> (bit % 32)) & mask;
+    }
+}
+
+#ifdef PALLETJACK_X86_DISPATCH
+// Same as UnpackBlockScalar, 8 values at a time
+__attribute__((target("avx2"))) void UnpackBlockAvx2(const uint32_t *words, uint32_t width, uint32_t *values)
+{
+    auto mask = _mm256_set1_epi32(static_cast<int>(width == 32 ? ~0u : (1u << width) - 1));
+    auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    for (uint32_t j = 0; j < kPackedBlockSize; j += 8)
+    {
+        auto bits = _mm256_mullo_epi32(_mm256_add_epi32(lanes, _mm256_set1_epi32(j)), _mm256_set1_epi32(width));
+        auto index = _mm256_srli_epi32(bits, 5);
+        auto shift = _mm256_and_si256(bits, _mm256_set1_epi32(31));
+        auto low = _mm256_i32gather_epi32((const int *)words, index, 4);
+        auto high = _mm256_i32gather_epi32((const int *)words + 1, index, 4);
+        // Variable shifts by 32 give 0, so the high word drops out for values that don't cross a word boundary
+        auto value = _mm256_or_si256(_mm256_srlv_epi32(low, shift), _mm256_sllv_epi32(high, _mm256_sub_epi32(_mm256_set1_epi32(32), shift)));
+        _mm256_storeu_si256((__m256i *)&values[j], _mm256_and_si256(value, mask));
+    }
+}
+#endif
+
+using UnpackBlockFunction = void (*)(const uint32_t *words, uint32_t width, uint32_t *values);
+
+UnpackBlockFunction GetUnpackBlock()
+{
+#ifdef PALLETJACK_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return UnpackBlockAvx2;
+#endif
+    return UnpackBlockScalar;
+}
+
+struct PackedBlock
+{
+    uint32_t base;         // First offset of the block
+    uint32_t words_offset; // Offset of the block's words, relative to the words of the row group
+};
+
+/* Packed column chunks offsets section (ExtensionSectionId::PackedColumnChunksOffsets), written instead of
+   column_chunks_offsets with FLAG_PACKED_COLUMN_CHUNKS_OFFSETS:
+|       | row group offsets | (uint64[rg + 1]) - Offset of the data of each row group from the start of the section
+|       --------------------|
+|       | row group data    | The (1 + c + 1) offsets of the row group in blocks of kPackedBlockSize, for every row group:
+|       |   blocks          | (PackedBlock[blocks + 1]) - The width of a block is the difference of the next words_offset and its own,
+|       |                   |                             as kPackedBlockSize values of width bits take width words
+|       |   words           | (uint32[]) - Deltas to the previous offset (0 for the first one), bit-packed LSB first,
+|       |                   |              followed by a padding word, so a value can always be read from two words
+*/
+class PackedColumnChunksOffsets
+{
+    uint32_t row_groups;
+    const uint64_t *row_group_offsets;
+
+public:
+    static uint64_t GetRowGroupOffsetsLength(const DataHeader &dataHeader) { return (uint64_t(dataHeader.row_groups) + 1) * sizeof(uint64_t); }
+    static uint64_t GetBlocks(const DataHeader &dataHeader) { return (1 + uint64_t(dataHeader.columns) + 1 + kPackedBlockSize - 1) / kPackedBlockSize; }
+
+    static std::shared_ptr<arrow::Buffer> Build(const DataHeader &dataHeader, const std::vector<uint32_t> &column_chunks_offsets)
+    {
+        auto entries = 1 + dataHeader.columns + 1;
+        auto blocks_count = GetBlocks(dataHeader);
+        std::vector<uint64_t> row_group_offsets(dataHeader.row_groups + 1);
+        std::vector<uint32_t> data;
+        for (uint32_t row_group = 0; row_group < dataHeader.row_groups; row_group++)
+        {
+            row_group_offsets[row_group] = GetRowGroupOffsetsLength(dataHeader) + data.size() * sizeof(uint32_t);
+            auto offsets = &column_chunks_offsets[uint64_t(entries) * row_group];
+            auto blocks_start = data.size();
+            data.resize(blocks_start + (blocks_count + 1) * 2);
+            uint32_t words_offset = 0;
+            for (uint64_t block = 0; block < blocks_count; block++)
+            {
+                uint32_t deltas[kPackedBlockSize] = {};
+                uint32_t max_delta = 0;
+                for (uint64_t j = 1; j < kPackedBlockSize && block * kPackedBlockSize + j < entries; j++)
+                {
+                    auto entry = block * kPackedBlockSize + j;
+                    if (offsets[entry] < offsets[entry - 1])
+                        throw std::logic_error("Column chunk offsets are not monotonic, they can't be packed!");
+
+                    deltas[j] = offsets[entry] - offsets[entry - 1];
+                    max_delta = std::max(max_delta, deltas[j]);
+                }
+
+                uint32_t width = std::bit_width(max_delta);
+                std::vector<uint32_t> words(width + 1);
+                for (uint32_t j = 0; j < kPackedBlockSize; j++)
+                {
+                    uint64_t bit = j * width;
+                    uint64_t value = uint64_t(deltas[j]) << (bit % 32);
+                    words[bit / 32] |= uint32_t(value);
+                    words[bit / 32 + 1] |= uint32_t(value >> 32);
+                }
+
+                data[blocks_start + block * 2] = TO_FILE_ENDIANESS(offsets[block * kPackedBlockSize]);
+                data[blocks_start + block * 2 + 1] = TO_FILE_ENDIANESS(words_offset);
+                for (uint32_t w = 0; w < width; w++)
+                    data.push_back(TO_FILE_ENDIANESS(words[w]));
+
+                words_offset += width;
+            }
+
+            data[blocks_start + blocks_count * 2 + 1] = TO_FILE_ENDIANESS(words_offset);
+            data.push_back(0); // padding word
+            if (data.size() % 2 != 0)
+                data.push_back(0); // keeps the row group data 8-byte aligned
+        }
+
+        row_group_offsets[dataHeader.row_groups] = GetRowGroupOffsetsLength(dataHeader) + data.size() * sizeof(uint32_t);
+        std::shared_ptr<arrow::ResizableBuffer> section;
+        PARQUET_ASSIGN_OR_THROW(section, arrow::AllocateResizableBuffer(row_group_offsets[dataHeader.row_groups]));
+        for (auto &row_group_offset : row_group_offsets)
+            row_group_offset = TO_FILE_ENDIANESS(row_group_offset);
+
+        memcpy(section->mutable_data(), row_group_offsets.data(), GetRowGroupOffsetsLength(dataHeader));
+        memcpy(section->mutable_data() + GetRowGroupOffsetsLength(dataHeader), data.data(), data.size() * sizeof(uint32_t));
+        return section;
+    }
+
+    // row_group_offsets has GetRowGroupOffsetsLength bytes, the row group data is read separately
+    PackedColumnChunksOffsets(const DataHeader &dataHeader, const uint8_t *row_group_offsets, uint64_t section_length)
+        : row_groups(dataHeader.row_groups),
+          row_group_offsets((const uint64_t *)row_group_offsets)
+    {
+        auto row_group_length = (GetBlocks(dataHeader) + 1) * sizeof(PackedBlock) + sizeof(uint32_t);
+        uint64_t previous_offset = GetRowGroupOffsetsLength(dataHeader);
+        bool valid = section_length >= previous_offset;
+        for (uint32_t row_group = 0; valid && row_group <= row_groups; row_group++)
+        {
+            auto offset = FROM_FILE_ENDIANESS(this->row_group_offsets[row_group]);
+            valid = offset % 8 == 0 && offset <= section_length && offset >= previous_offset &&
+                    (row_group == 0 || offset - previous_offset >= row_group_length);
+            previous_offset = offset;
+        }
+
+        if (!valid)
+        {
+            auto msg = std::string("Index packed column chunks offsets section is invalid!");
+            throw std::logic_error(msg);
+        }
+    }
+
+    // Range of the row group data, relative to the start of the section
+    std::pair<uint64_t, uint64_t> GetRowGroupRange(uint32_t row_group) const
+    {
+        auto offset = FROM_FILE_ENDIANESS(row_group_offsets[row_group]);
+        return {offset, FROM_FILE_ENDIANESS(row_group_offsets[row_group + 1]) - offset};
+    }
+};
+
+// Reads the offsets of one row group from its packed data, a block at a time
+class PackedColumnChunksRow
+{
+    const PackedBlock *blocks;
+    const uint32_t *words;
+    uint64_t blocks_count;
+    uint64_t words_length;
+    uint64_t decoded_block = std::numeric_limits<uint64_t>::max();
+    uint32_t values[kPackedBlockSize];
+
+    void Decode(uint64_t block)
+    {
+        static const UnpackBlockFunction unpack_block = GetUnpackBlock();
+
+        auto words_offset = FROM_FILE_ENDIANESS(blocks[block].words_offset);
+        auto words_end = FROM_FILE_ENDIANESS(blocks[block + 1].words_offset);
+        if (words_end < words_offset || words_end - words_offset > 32 || words_end >= words_length)
+        {
+            auto msg = std::string("Index packed column chunks offsets section is invalid!");
+            throw std::logic_error(msg);
+        }
+
+        if (words_end == words_offset)
+            std::fill(std::begin(values), std::end(values), 0);
+        else
+            unpack_block(&words[words_offset], words_end - words_offset, values);
+
+        values[0] += FROM_FILE_ENDIANESS(blocks[block].base);
+        for (size_t j = 1; j < kPackedBlockSize; j++)
+            values[j] += values[j - 1];
+
+        decoded_block = block;
+    }
+
+public:
+    // data is the range returned by PackedColumnChunksOffsets::GetRowGroupRange, validated by its constructor
+    PackedColumnChunksRow(const DataHeader &dataHeader, const uint8_t *data, uint64_t length)
+        : blocks((const PackedBlock *)data),
+          blocks_count(PackedColumnChunksOffsets::GetBlocks(dataHeader))
+    {
+        auto blocks_length = (blocks_count + 1) * sizeof(PackedBlock);
+        words = (const uint32_t *)(data + blocks_length);
+        words_length = (length - blocks_length) / sizeof(uint32_t);
+    }
+
+    uint32_t operator[](uint64_t entry)
+    {
+        auto block = entry / kPackedBlockSize;
+        if (block != decoded_block)
+            Decode(block);
+
+        return values[entry % kPackedBlockSize];
+    }
+};
+
+/* Row group statistics section (ExtensionSectionId::RowGroupStatistics):
+|       | types             | (uint8[c]) - palletjack::StatisticsType of each column, padded to 8 bytes
+|       --------------------|
+|       | column statistics | For every column with a type other than None, in column order:
+|       |   has min max     | (uint64[(rg + 63) / 64]) - Bitmap of the row groups with min and max, LSB first like Arrow's validity bitmaps
+|       |   has null count  | (uint64[(rg + 63) / 64]) - Bitmap of the row groups with a null count
+|       |   min             | (8 bytes[rg]) - int64, uint64 or double by the type of the column, 0 for row groups without them
+|       |   max             | (8 bytes[rg])
+|       |   null counts     | (int64[rg])
+*/
+class RowGroupStatistics
+{
+    const uint8_t *types;
+    std::vector<uint64_t> column_offsets; // c, offset of the statistics of each column from the start of the section
+
+public:
+    static uint64_t GetTypesLength(const DataHeader &dataHeader) { return AlignExtensionOffset(dataHeader.columns); }
+    static uint64_t GetBitmapLength(const DataHeader &dataHeader) { return (uint64_t(dataHeader.row_groups) + 63) / 64 * sizeof(uint64_t); }
+    static uint64_t GetColumnLength(const DataHeader &dataHeader) { return 2 * GetBitmapLength(dataHeader) + 3 * uint64_t(dataHeader.row_groups) * sizeof(uint64_t); }
+
+    // Columns without a TYPE_ORDER column order or without any statistics are stored as None
+    static std::shared_ptr<arrow::Buffer> Build(const DataHeader &dataHeader, const MetadataOffsets &metadata)
+    {
+        uint64_t columns = dataHeader.columns;
+        uint64_t row_groups = dataHeader.row_groups;
+        std::vector<palletjack::StatisticsType> types(columns, palletjack::StatisticsType::None);
+        uint64_t typed_columns = 0;
+        for (uint64_t column = 0; column < columns; column++)
+        {
+            bool type_defined_order = column < metadata.type_defined_orders.size() && metadata.type_defined_orders[column];
+            bool has_statistics = false;
+            for (uint64_t row_group = 0; row_group < row_groups && !has_statistics; row_group++)
+                has_statistics = metadata.statistics_flags[row_group * columns + column] != 0;
+
+            if (type_defined_order && has_statistics && metadata.statistics_types[column] != palletjack::StatisticsType::None)
+            {
+                types[column] = metadata.statistics_types[column];
+                typed_columns++;
+            }
+        }
+
+        auto bitmap_words = GetBitmapLength(dataHeader) / sizeof(uint64_t);
+        std::vector<uint64_t> section((GetTypesLength(dataHeader) + typed_columns * GetColumnLength(dataHeader)) / sizeof(uint64_t));
+        memcpy(section.data(), types.data(), columns);
+        auto block = &section[GetTypesLength(dataHeader) / sizeof(uint64_t)];
+        for (uint64_t column = 0; column < columns; column++)
+        {
+            if (types[column] == palletjack::StatisticsType::None)
+                continue;
+
+            auto has_min_max = block;
+            auto has_null_count = &block[bitmap_words];
+            auto min = &block[2 * bitmap_words];
+            auto max = &min[row_groups];
+            auto null_counts = &max[row_groups];
+            for (uint64_t row_group = 0; row_group < row_groups; row_group++)
+            {
+                auto entry = row_group * columns + column;
+                auto flags = metadata.statistics_flags[entry];
+                if (flags & STATISTICS_HAS_MIN_MAX)
+                {
+                    has_min_max[row_group / 64] |= uint64_t(1) << (row_group % 64);
+                    min[row_group] = TO_FILE_ENDIANESS(metadata.statistics_min[entry]);
+                    max[row_group] = TO_FILE_ENDIANESS(metadata.statistics_max[entry]);
+                }
+
+                if (flags & STATISTICS_HAS_NULL_COUNT)
+                {
+                    has_null_count[row_group / 64] |= uint64_t(1) << (row_group % 64);
+                    null_counts[row_group] = TO_FILE_ENDIANESS(static_cast<uint64_t>(metadata.statistics_null_counts[entry]));
+                }
+            }
+
+            block += GetColumnLength(dataHeader) / sizeof(uint64_t);
+        }
+
+        return arrow::Buffer::FromVector(std::move(section));
+    }
+
+    // types has GetTypesLength bytes, the statistics of the columns are read separately
+    RowGroupStatistics(const DataHeader &dataHeader, const uint8_t *types, uint64_t section_length)
+        : types(types),
+          column_offsets(dataHeader.columns)
+    {
+        uint64_t offset = GetTypesLength(dataHeader);
+        bool valid = section_length >= offset;
+        for (uint32_t column = 0; valid && column < dataHeader.columns; column++)
+        {
+            valid = types[column] <= static_cast<uint8_t>(palletjack::StatisticsType::BytesPrefix);
+            column_offsets[column] = offset;
+            if (types[column] != static_cast<uint8_t>(palletjack::StatisticsType::None))
+                offset += GetColumnLength(dataHeader);
+        }
+
+        if (!valid || offset != section_length)
+        {
+            auto msg = std::string("Index row group statistics section is invalid!");
+            throw std::logic_error(msg);
+        }
+    }
+
+    palletjack::StatisticsType GetType(uint32_t column) const { return static_cast<palletjack::StatisticsType>(types[column]); }
+
+    // Offset of the statistics of a column with a type other than None, relative to the start of the section
+    uint64_t GetColumnOffset(uint32_t column) const { return column_offsets[column]; }
+};
+
+struct SortedKeyHeader
+{
+    uint32_t column = 0;
+    uint8_t type = 0;       // palletjack::StatisticsType
+    uint8_t descending = 0; // 1 if the row groups are sorted in descending key order
+    uint8_t reserved[2] = {};
+};
+
+/* Sorted key section (ExtensionSectionId::SortedKey):
+|       | header     | (SortedKeyHeader) - The key column, the type of its values and the sort direction
+|       | has values | (uint64[(rg + 63) / 64]) - Bitmap of the row groups with a min and max key, LSB first
+|       | min        | (8 bytes[rg]) - int64, uint64 or double by the type, row groups without values repeat the last bound before them
+|       | max        | (8 bytes[rg])   so both arrays are sorted in the key order
+*/
+class SortedKey
+{
+    const uint8_t *data;
+    SortedKeyHeader header;
+    uint32_t row_groups;
+
+    static uint64_t GetBitmapLength(uint32_t row_groups) { return (uint64_t(row_groups) + 63) / 64 * sizeof(uint64_t); }
+
+    uint64_t GetValues(uint64_t array) const { return sizeof(SortedKeyHeader) + GetBitmapLength(row_groups) + array * row_groups * sizeof(uint64_t); }
+
+    template <typename T>
+    T GetValue(uint64_t array, uint32_t row_group) const
+    {
+        return std::bit_cast<T>(FROM_FILE_ENDIANESS(arrow::util::SafeLoadAs<uint64_t>(data + GetValues(array) + row_group * sizeof(uint64_t))));
+    }
+
+    // The first row group for which predicate fails, predicate holds for a prefix of the sorted array
+    template <typename T, typename TPredicate>
+    uint32_t PartitionPoint(uint64_t array, TPredicate predicate) const
+    {
+        uint32_t first = 0;
+        uint32_t count = row_groups;
+        while (count > 0)
+        {
+            auto step = count / 2;
+            if (predicate(GetValue<T>(array, first + step)))
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    template <typename T>
+    std::pair<uint32_t, uint32_t> FindRange(std::optional<uint64_t> min, std::optional<uint64_t> max) const
+    {
+        constexpr uint64_t kMin = 0;
+        constexpr uint64_t kMax = 1;
+        uint32_t first = 0;
+        uint32_t end = row_groups;
+        if (!header.descending)
+        {
+            if (min)
+                first = PartitionPoint<T>(kMax, [&](T value)
+                                          { return value < std::bit_cast<T>(*min); });
+            if (max)
+                end = PartitionPoint<T>(kMin, [&](T value)
+                                        { return value <= std::bit_cast<T>(*max); });
+        }
+        else
+        {
+            if (max)
+                first = PartitionPoint<T>(kMin, [&](T value)
+                                          { return value > std::bit_cast<T>(*max); });
+            if (min)
+                end = PartitionPoint<T>(kMax, [&](T value)
+                                        { return value >= std::bit_cast<T>(*min); });
+        }
+
+        return {first, std::max(first, end)};
+    }
+
+    // Checks that the row groups are sorted by the encoded keys, and fills the row groups without keys
+    template <typename T>
+    static bool SortKeys(uint64_t *min, uint64_t *max, const std::vector<bool> &has_values, bool descending)
+    {
+        // In the key order, the first key of a row group is its min when ascending and its max when descending
+        auto first_keys = descending ? max : min;
+        auto last_keys = descending ? min : max;
+        auto before = [descending](uint64_t a, uint64_t b)
+        { return descending ? std::bit_cast<T>(b) < std::bit_cast<T>(a) : std::bit_cast<T>(a) < std::bit_cast<T>(b); };
+
+        std::optional<uint64_t> bound; // The last key of the row groups so far
+        size_t first_with_values = 0;
+        for (size_t row_group = 0; row_group < has_values.size(); row_group++)
+        {
+            if (!has_values[row_group])
+            {
+                if (bound)
+                    min[row_group] = max[row_group] = *bound;
+                continue;
+            }
+
+            if (before(last_keys[row_group], first_keys[row_group]) || (bound && before(first_keys[row_group], *bound)))
+                return false;
+
+            if (!bound)
+                first_with_values = row_group;
+            bound = last_keys[row_group];
+        }
+
+        if (!bound)
+            return false;
+
+        std::fill(min, min + first_with_values, first_keys[first_with_values]);
+        std::fill(max, max + first_with_values, first_keys[first_with_values]);
+        return true;
+    }
+
+public:
+    static uint64_t GetLength(const DataHeader &dataHeader)
+    {
+        return sizeof(SortedKeyHeader) + GetBitmapLength(dataHeader.row_groups) + 2 * uint64_t(dataHeader.row_groups) * sizeof(uint64_t);
+    }
+
+    // The key is the first sorting column of the row groups, they must all declare the same one
+    static std::shared_ptr<arrow::Buffer> Build(const char *parquet_path, const DataHeader &dataHeader, const MetadataOffsets &metadata)
+    {
+        uint64_t columns = dataHeader.columns;
+        uint64_t row_groups = dataHeader.row_groups;
+        auto column = metadata.sorting_columns[0];
+        bool descending = metadata.sorting_descending[0];
+        for (uint64_t row_group = 0; row_group < row_groups; row_group++)
+        {
+            if (metadata.sorting_columns[row_group] != column || metadata.sorting_descending[row_group] != descending || column < 0 || uint64_t(column) >= columns)
+            {
+                auto msg = std::string("The row groups of '") + parquet_path + "' don't declare the same sorting column, a sorted key index needs one!";
+                throw std::logic_error(msg);
+            }
+        }
+
+        auto type = metadata.statistics_types[column];
+        if (type == palletjack::StatisticsType::None || uint64_t(column) >= metadata.type_defined_orders.size() || !metadata.type_defined_orders[column])
+        {
+            auto msg = std::string("The sorting column of '") + parquet_path + "' has no ordered statistics, a sorted key index can't be built!";
+            throw std::logic_error(msg);
+        }
+
+        std::vector<uint64_t> section(GetLength(dataHeader) / sizeof(uint64_t));
+        SortedKeyHeader header;
+        header.column = column;
+        header.type = static_cast<uint8_t>(type);
+        header.descending = descending;
+        memcpy(section.data(), &header, sizeof(header));
+
+        auto has_values_bitmap = &section[sizeof(SortedKeyHeader) / sizeof(uint64_t)];
+        auto min = &has_values_bitmap[GetBitmapLength(dataHeader.row_groups) / sizeof(uint64_t)];
+        auto max = &min[row_groups];
+        std::vector<bool> has_values(row_groups);
+        for (uint64_t row_group = 0; row_group < row_groups; row_group++)
+        {
+            auto entry = row_group * columns + column;
+            has_values[row_group] = metadata.statistics_flags[entry] & STATISTICS_HAS_MIN_MAX;
+            if (has_values[row_group])
+            {
+                has_values_bitmap[row_group / 64] |= uint64_t(1) << (row_group % 64);
+                min[row_group] = metadata.statistics_min[entry];
+                max[row_group] = metadata.statistics_max[entry];
+            }
+        }
+
+        bool sorted = false;
+        switch (type)
+        {
+        case palletjack::StatisticsType::Int64:
+            sorted = SortKeys<int64_t>(min, max, has_values, descending);
+            break;
+        case palletjack::StatisticsType::Double:
+            sorted = SortKeys<double>(min, max, has_values, descending);
+            break;
+        default:
+            sorted = SortKeys<uint64_t>(min, max, has_values, descending);
+            break;
+        }
+
+        if (!sorted)
+        {
+            auto msg = std::string("The row groups of '") + parquet_path + "' are not sorted by their sorting column, a sorted key index can't be built!";
+            throw std::logic_error(msg);
+        }
+
+        for (uint64_t row_group = 0; row_group < row_groups; row_group++)
+        {
+            min[row_group] = TO_FILE_ENDIANESS(min[row_group]);
+            max[row_group] = TO_FILE_ENDIANESS(max[row_group]);
+        }
+
+        return arrow::Buffer::FromVector(std::move(section));
+    }
+
+    SortedKey(const DataHeader &dataHeader, const uint8_t *data, uint64_t section_length)
+        : data(data),
+          row_groups(dataHeader.row_groups)
+    {
+        if (section_length == GetLength(dataHeader))
+            memcpy(&header, data, sizeof(header));
+
+        if (section_length != GetLength(dataHeader) || header.column >= dataHeader.columns || header.descending > 1 ||
+            header.type == static_cast<uint8_t>(palletjack::StatisticsType::None) || header.type > static_cast<uint8_t>(palletjack::StatisticsType::BytesPrefix))
+        {
+            auto msg = std::string("Index sorted key section is invalid!");
+            throw std::logic_error(msg);
+        }
+    }
+
+    uint32_t GetColumn() const { return header.column; }
+    palletjack::StatisticsType GetType() const { return static_cast<palletjack::StatisticsType>(header.type); }
+
+    // The row groups with keys in [min, max], bounds encoded like the statistics of the key, nullopt for an open end.
+    // Exact for the numeric keys, a superset for the prefixes of the strings.
+    std::vector<uint32_t> FindRowGroups(std::optional<uint64_t> min, std::optional<uint64_t> max) const
+    {
+        std::pair<uint32_t, uint32_t> range;
+        switch (GetType())
+        {
+        case palletjack::StatisticsType::Int64:
+            range = FindRange<int64_t>(min, max);
+            break;
+        case palletjack::StatisticsType::Double:
+            range = FindRange<double>(min, max);
+            break;
+        default:
+            range = FindRange<uint64_t>(min, max);
+            break;
+        }
+
+        std::vector<uint32_t> result;
+        auto has_values = data + sizeof(SortedKeyHeader);
+        for (auto row_group = range.first; row_group < range.second; row_group++)
+        {
+            if (arrow::bit_util::GetBit(has_values, row_group))
+                result.push_back(row_group);
+        }
+
+        return result;
+    }
+};
+
+/* Strip ranges section (ExtensionSectionId::StripRanges):
+|       | ranges | (uint32[rg * c * 2]) - For every column chunk, row group by row group: the begin and end of its strippable
+|       |        |   ColumnMetaData fields relative to the chunk, 0 and 0 if it has none or they aren't its last fields
+*/
+class StripRanges
+{
+    const uint8_t *data;
+    uint32_t first_column;
+
+public:
+    static std::shared_ptr<arrow::Buffer> Build(const MetadataOffsets &metadata)
+    {
+        std::vector<uint32_t> section(metadata.strip_ranges.size());
+        for (size_t i = 0; i < section.size(); i++)
+            section[i] = TO_FILE_ENDIANESS(metadata.strip_ranges[i]);
+
+        return arrow::Buffer::FromVector(std::move(section));
+    }
+
+    // The range of the section with the columns first_column..last_column of a row group
+    static std::pair<uint64_t, uint64_t> GetRange(const DataHeader &dataHeader, uint32_t row_group, uint32_t first_column, uint32_t last_column)
+    {
+        return {(uint64_t(row_group) * dataHeader.columns + first_column) * 2 * sizeof(uint32_t), (uint64_t(last_column) - first_column + 1) * 2 * sizeof(uint32_t)};
+    }
+
+    static void Validate(const DataHeader &dataHeader, uint64_t section_length)
+    {
+        if (section_length != uint64_t(dataHeader.row_groups) * dataHeader.columns * 2 * sizeof(uint32_t))
+        {
+            auto msg = std::string("Index strip ranges section is invalid!");
+            throw std::logic_error(msg);
+        }
+    }
+
+    // data is a range returned by GetRange starting at first_column
+    StripRanges(const uint8_t *data, uint32_t first_column) : data(data), first_column(first_column) {}
+
+    std::pair<uint32_t, uint32_t> Get(uint32_t column) const
+    {
+        auto range = reinterpret_cast<const uint32_t *>(data) + 2 * (uint64_t(column) - first_column);
+        return {FROM_FILE_ENDIANESS(arrow::util::SafeLoad(range)), FROM_FILE_ENDIANESS(arrow::util::SafeLoad(range + 1))};
+    }
+};
+
+// Appends the extensions header, the section directory and the section payloads after the index body
+void WriteExtensionSections(arrow::io::BufferOutputStream *fs, const std::vector<std::pair<ExtensionSectionId, std::shared_ptr<arrow::Buffer>>> &payloads)
+{
+    const uint8_t padding[8] = {};
+    auto write_padding = [&]()
+    {
+        int64_t position;
+        PARQUET_ASSIGN_OR_THROW(position, fs->Tell());
+        PARQUET_THROW_NOT_OK(fs->Write(padding, AlignExtensionOffset(position) - position));
+        return AlignExtensionOffset(position);
+    };
+
+    auto extensions_offset = write_padding();
+    ExtensionsHeader extensionsHeader;
+    extensionsHeader.sections = payloads.size();
+    std::vector<ExtensionSection> sections(payloads.size());
+    uint64_t payload_offset = AlignExtensionOffset(extensions_offset + sizeof(ExtensionsHeader) + sections.size() * sizeof(ExtensionSection));
+    for (size_t i = 0; i < payloads.size(); i++)
+    {
+        sections[i].id = static_cast<uint32_t>(payloads[i].first);
+        sections[i].offset = payload_offset;
+        sections[i].length = payloads[i].second->size();
+        payload_offset = AlignExtensionOffset(payload_offset + sections[i].length);
+    }
+
+    PARQUET_THROW_NOT_OK(fs->Write(&extensionsHeader, sizeof(extensionsHeader)));
+    PARQUET_THROW_NOT_OK(fs->Write(sections.data(), sections.size() * sizeof(ExtensionSection)));
+    for (const auto &payload : payloads)
+    {
+        write_padding();
+        PARQUET_THROW_NOT_OK(fs->Write(payload.second->data(), payload.second->size()));
+    }
+}
+
+// Reads the section directory that follows the index body, TRead returns the index bytes at (offset, length).
+// Returns false when the index has no extensions.
+template <typename TRead>
+bool ReadExtensionSections(const DataHeader &dataHeader, uint64_t index_length, TRead read, std::vector<ExtensionSection> &sections)
+{
+    auto extensions_offset = GetExtensionsOffset(dataHeader);
+    if (index_length < extensions_offset + sizeof(ExtensionsHeader))
+        return false;
+
+    ExtensionsHeader extensionsHeader;
+    memcpy(&extensionsHeader, read(extensions_offset, sizeof(ExtensionsHeader))->data(), sizeof(ExtensionsHeader));
+    if (memcmp(EXTENSIONS_HEADER_V1, extensionsHeader.header, EXTENSIONS_HEADER_V1_LENGTH) != 0)
+        return false;
+
+    auto directory_offset = extensions_offset + sizeof(ExtensionsHeader);
+    if ((index_length - directory_offset) / sizeof(ExtensionSection) < extensionsHeader.sections)
+    {
+        auto msg = std::string("Index extension sections are invalid!");
+        throw std::logic_error(msg);
+    }
+
+    sections.resize(extensionsHeader.sections);
+    auto directory_length = sections.size() * sizeof(ExtensionSection);
+    if (directory_length > 0)
+        memcpy(sections.data(), read(directory_offset, directory_length)->data(), directory_length);
+
+    for (const auto &section : sections)
+    {
+        if (section.offset > index_length || section.length > index_length - section.offset)
+        {
+            auto msg = std::string("Index extension sections are invalid!");
+            throw std::logic_error(msg);
+        }
+    }
+
+    return true;
+}
+
+const ExtensionSection *FindExtensionSection(const std::vector<ExtensionSection> &sections, ExtensionSectionId id)
+{
+    for (const auto &section : sections)
+    {
+        if (section.id == static_cast<uint32_t>(id))
+            return &section;
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<arrow::Buffer> BuildMetadataIndex(const char *parquet_path, std::shared_ptr<arrow::Buffer> thrift_buffer, const GenerateMetadataIndexOptions &options)
+{
+    // The thrift metadata is scanned only once, straight from the footer bytes
+    MetadataOffsets metadata;
+    metadata.scan_statistics = options.row_group_statistics || options.sorted_key_index;
+    metadata.scan_sorting_columns = options.sorted_key_index;
+    metadata.scan_strip_ranges = options.strip_ranges;
+    ThriftOffsetScanner(thrift_buffer->data(), thrift_buffer->size(), metadata).ScanFileMetaData();
+    if (metadata.encryption_algorithm)
+    {
+        throw parquet::ParquetException(
+            "Encrypted column metadata is not supported: '" + std::string(parquet_path) + "'.");
+    }
+
+    DataHeader data_header = {};
+    data_header.version = options.format_version == 0 ? 2 : options.format_version;
+    data_header.row_groups = metadata.row_groups_offsets.size() > 0 ? metadata.row_groups_offsets.size() - 2 : 0;
+    data_header.columns = metadata.schema_leaves;
+    data_header.metadata_length = thrift_buffer->size();
+
+    // The column names of a nested schema are the paths of all its elements, so groups can be selected by name too
+    std::vector<std::string_view> column_names(metadata.schema_names.begin() + std::min<size_t>(1, metadata.schema_names.size()), metadata.schema_names.end());
+    std::vector<std::string> schema_paths;
+    if (column_names.size() > data_header.columns)
+    {
+        if (options.format_version == 2)
+        {
+            auto msg = std::string("The schema of '") + parquet_path + "' is nested, nested schemas need index format version 3!";
+            throw std::logic_error(msg);
+        }
+
+        data_header.flags |= FLAG_NESTED_SCHEMA;
+        data_header.schema_elements = column_names.size();
+        schema_paths = SchemaTree(metadata.schema_num_children, metadata.schema_map_groups, data_header.columns).GetPaths(metadata.schema_names);
+        column_names.assign(schema_paths.begin(), schema_paths.end());
+    }
+
+    column_names.resize(std::min<size_t>(column_names.size(), data_header.get_schema_elements()));
+    for (auto name : column_names)
+    {
+        data_header.column_names_length += name.length() + 1;
+    }
+
+    // Validate data
+    {
+        if (data_header.row_groups == 0)
+            throw std::logic_error("Number of row groups is not set!");
+        if (data_header.columns == 0)
+            throw std::logic_error("Number of columns is not set!");
+        if (data_header.metadata_length == 0)
+            throw std::logic_error("Metadata length is not set!");
+
+        if (data_header.get_num_rows_offsets_size() != metadata.num_rows_offsets.size())
+        {
+            auto msg = std::string("Number of rows offset information is invalid, ") + std::to_string(data_header.get_num_rows_offsets_size()) + " != " + std::to_string(metadata.num_rows_offsets.size()) + " !";
+            throw std::logic_error(msg);
+        }
+
+        if (data_header.row_groups != metadata.row_numbers.size())
+        {
+            auto msg = std::string("Row numbers information is invalid, ") + std::to_string(data_header.row_groups) + " != " + std::to_string(metadata.row_numbers.size()) + " !";
+            throw std::logic_error(msg);
+        }
+
+        if (data_header.get_schema_offsets_size() != metadata.schema_offsets.size())
+        {
+            auto msg = std::string("Schema offsets information is invalid, columns=") + std::to_string(data_header.columns) + ", schema_offsets=" + std::to_string(metadata.schema_offsets.size()) + " !";
+            throw std::logic_error(msg);
+        }
+
+        if (data_header.get_schema_num_children_offsets_size() != metadata.schema_num_children_offsets.size())
+        {
+            auto msg = std::string("Num children offsets information is invalid, num_children_offsets=") + std::to_string(metadata.schema_num_children_offsets.size()) + " !";
+            throw std::logic_error(msg);
+        }
+
+        if (data_header.get_row_groups_offsets_size() != metadata.row_groups_offsets.size())
+        {
+            auto msg = std::string("Row group offsets information is invalid, columns=") + std::to_string(data_header.row_groups) + ", row_groups_offsets=" + std::to_string(metadata.row_groups_offsets.size()) + " !";
+
+            throw std::logic_error(msg);
+        }
+
+        // column_orders is optional
+        if (metadata.column_orders_offsets.size() == 0)
+        {
+            metadata.column_orders_offsets.resize(data_header.get_column_orders_offsets_size());
+        }
+
+        if (data_header.get_column_orders_offsets_size() != metadata.column_orders_offsets.size())
+        {
+            auto msg = std::string("Column orders offsets information is invalid, columns=") + std::to_string(data_header.columns) + ", column_orders_offsets=" + std::to_string(metadata.column_orders_offsets.size()) + " !";
+
+            throw std::logic_error(msg);
+        }
+
+        for (auto column_chunks_offsets_size : metadata.column_chunks_offsets_sizes)
+        {
+            if (data_header.get_column_chunks_offsets_size() / data_header.row_groups != column_chunks_offsets_size)
+            {
+                auto msg = std::string("Column chunk offsets information is invalid, columns=") + std::to_string(data_header.columns) + ", column_chunks_offsets=" + std::to_string(column_chunks_offsets_size) + " !";
+
+                throw std::logic_error(msg);
+            }
+        }
+
+        if (metadata.scan_statistics &&
+            (metadata.statistics_types.size() != data_header.columns || metadata.statistics_flags.size() != uint64_t(data_header.row_groups) * data_header.columns))
+        {
+            auto msg = std::string("Row group statistics information is invalid, columns=") + std::to_string(data_header.columns) + ", statistics_types=" + std::to_string(metadata.statistics_types.size()) + " !";
+            throw std::logic_error(msg);
+        }
+
+        if (metadata.scan_sorting_columns && metadata.sorting_columns.size() != data_header.row_groups)
+        {
+            auto msg = std::string("Sorting columns information is invalid, row_groups=") + std::to_string(data_header.row_groups) + ", sorting_columns=" + std::to_string(metadata.sorting_columns.size()) + " !";
+            throw std::logic_error(msg);
+        }
+
+        if (metadata.scan_strip_ranges && metadata.strip_ranges.size() != uint64_t(data_header.row_groups) * data_header.columns * 2)
+        {
+            auto msg = std::string("Strip ranges information is invalid, columns=") + std::to_string(data_header.columns) + ", strip_ranges=" + std::to_string(metadata.strip_ranges.size()) + " !";
+            throw std::logic_error(msg);
+        }
+    }
+
+    if (options.packed_offsets && options.format_version == 2)
+    {
+        throw std::logic_error("Packed offsets need index format version 3!");
+    }
+
+    if (options.column_major_offsets && options.format_version == 2)
+    {
+        throw std::logic_error("Column-major offsets need index format version 3!");
+    }
+
+    if (options.packed_offsets && options.column_major_offsets)
+    {
+        throw std::logic_error("Packed offsets and column-major offsets can't be combined!");
+    }
+
+    // PJ_2 stores row numbers as uint32 and older readers compute the index size in 32 bits
+    auto fits_version_2 = !options.packed_offsets && !options.column_major_offsets && !data_header.has_nested_schema() &&
+                          data_header.get_index_size() <= std::numeric_limits<uint32_t>::max() &&
+                          std::all_of(metadata.row_numbers.begin(), metadata.row_numbers.end(), [](int64_t row_number)
+                                      { return row_number >= 0 && row_number <= std::numeric_limits<uint32_t>::max(); });
+    if (options.format_version == 0 && !fits_version_2)
+    {
+        data_header.version = FORMAT_VERSION_3;
+    }
+    else if (data_header.version == 2 && !fits_version_2)
+    {
+        auto msg = std::string("The index of '") + parquet_path + "' doesn't fit format version 2, its row counts or its size need version 3!";
+        throw std::logic_error(msg);
+    }
+    else if (data_header.version != 2 && data_header.version != FORMAT_VERSION_3)
+    {
+        auto msg = std::string("Index format version=") + std::to_string(data_header.version) + " is not supported!";
+        throw std::logic_error(msg);
+    }
+
+    if (options.packed_offsets)
+    {
+        data_header.flags |= FLAG_PACKED_COLUMN_CHUNKS_OFFSETS;
+    }
+
+    if (options.column_major_offsets)
+    {
+        data_header.flags |= FLAG_COLUMN_MAJOR_COLUMN_CHUNKS_OFFSETS;
+    }
+
+    auto total_size = data_header.get_index_size();
+    std::shared_ptr<arrow::io::BufferOutputStream> fs;
+    PARQUET_ASSIGN_OR_THROW(fs, arrow::io::BufferOutputStream::Create(total_size, arrow::default_memory_pool()));
+
+    WriteDataHeader(fs.get(), data_header);
+    PARQUET_THROW_NOT_OK(fs->Write(&metadata.num_rows_offsets[0], sizeof(metadata.num_rows_offsets[0]) * metadata.num_rows_offsets.size()));
+    if (data_header.version == 2)
+    {
+        std::vector<uint32_t> row_numbers(metadata.row_numbers.begin(), metadata.row_numbers.end());
+        PARQUET_THROW_NOT_OK(fs->Write(&row_numbers[0], sizeof(row_numbers[0]) * row_numbers.size()));
+    }
+    else
+    {
+        PARQUET_THROW_NOT_OK(fs->Write(&metadata.row_numbers[0], sizeof(metadata.row_numbers[0]) * metadata.row_numbers.size()));
+    }
+    PARQUET_THROW_NOT_OK(fs->Write(&metadata.schema_offsets[0], sizeof(metadata.schema_offsets[0]) * metadata.schema_offsets.size()));
+    PARQUET_THROW_NOT_OK(fs->Write(&metadata.schema_num_children_offsets[0], sizeof(metadata.schema_num_children_offsets[0]) * metadata.schema_num_children_offsets.size()));
+    PARQUET_THROW_NOT_OK(fs->Write(&metadata.row_groups_offsets[0], sizeof(metadata.row_groups_offsets[0]) * metadata.row_groups_offsets.size()));
+    PARQUET_THROW_NOT_OK(fs->Write(&metadata.column_orders_offsets[0], sizeof(metadata.column_orders_offsets[0]) * metadata.column_orders_offsets.size()));
+    if (data_header.has_column_major_column_chunks_offsets())
+    {
+        auto entries = 1 + data_header.columns + 1;
+        std::vector<uint32_t> column_major(metadata.column_chunks_offsets.size());
+        for (uint64_t row_group = 0; row_group < data_header.row_groups; row_group++)
+        {
+            for (uint64_t entry = 0; entry < entries; entry++)
+                column_major[entry * data_header.row_groups + row_group] = metadata.column_chunks_offsets[row_group * entries + entry];
+        }
+
+        PARQUET_THROW_NOT_OK(fs->Write(&column_major[0], sizeof(column_major[0]) * column_major.size()));
+    }
+    else if (!data_header.has_packed_column_chunks_offsets())
+    {
+        PARQUET_THROW_NOT_OK(fs->Write(&metadata.column_chunks_offsets[0], sizeof(metadata.column_chunks_offsets[0]) * metadata.column_chunks_offsets.size()));
+    }
+
+    uint32_t written_column_names_length = 0;
+    const char terminator = '\0';
+    for (auto name : column_names)
+    {
+        PARQUET_THROW_NOT_OK(fs->Write(name.data(), name.length()));
+        PARQUET_THROW_NOT_OK(fs->Write(&terminator, 1));
+        written_column_names_length += name.length() + 1;
+    }
+
+    if (data_header.column_names_length != written_column_names_length)
+    {
+        throw std::logic_error("Error when writing the index file, data_header.column_names_length != written_column_names_length !");
+    }
+
+    PARQUET_THROW_NOT_OK(fs->Write(thrift_buffer->data(), thrift_buffer->size()));
+
+    int64_t written_size;
+    PARQUET_ASSIGN_OR_THROW(written_size, fs->Tell());
+    if (total_size != static_cast<size_t>(written_size))
+    {
+        auto msg = std::string("Error when writing the index file, expected size=") + std::to_string(total_size) + ", actual size=" + std::to_string(written_size) + " !";
+        throw std::logic_error(msg);
+    }
+
+    std::vector<std::pair<ExtensionSectionId, std::shared_ptr<arrow::Buffer>>> extension_sections;
+    if (data_header.has_packed_column_chunks_offsets())
+    {
+        extension_sections.emplace_back(ExtensionSectionId::PackedColumnChunksOffsets, PackedColumnChunksOffsets::Build(data_header, metadata.column_chunks_offsets));
+    }
+
+    if (options.column_names_hash)
+    {
+        extension_sections.emplace_back(ExtensionSectionId::ColumnNamesHash, ColumnNamesHash::Build(column_names));
+    }
+
+    if (options.row_group_statistics)
+    {
+        extension_sections.emplace_back(ExtensionSectionId::RowGroupStatistics, RowGroupStatistics::Build(data_header, metadata));
+    }
+
+    if (options.sorted_key_index)
+    {
+        extension_sections.emplace_back(ExtensionSectionId::SortedKey, SortedKey::Build(parquet_path, data_header, metadata));
+    }
+
+    if (options.strip_ranges)
+    {
+        extension_sections.emplace_back(ExtensionSectionId::StripRanges, StripRanges::Build(metadata));
+    }
+
+    if (extension_sections.size() > 0)
+    {
+        WriteExtensionSections(fs.get(), extension_sections);
+    }
+
+    std::shared_ptr<arrow::Buffer> result;
+    PARQUET_ASSIGN_OR_THROW(result, fs->Finish());
+    return result;
+}
+
+void WriteIndexFile(const char *index_file_path, const arrow::Buffer &buffer)
+{
+    std::shared_ptr<arrow::io::FileOutputStream> outfile;
+    PARQUET_ASSIGN_OR_THROW(outfile, arrow::io::FileOutputStream::Open(std::string(index_file_path)));
+    PARQUET_THROW_NOT_OK(outfile->Write(buffer.data(), buffer.size()));
+    PARQUET_THROW_NOT_OK(outfile->Close());
+}
+
+std::shared_ptr<arrow::Buffer> GenerateMetadataIndex(const char *parquet_path, const GenerateMetadataIndexOptions &options)
+{
+    return BuildMetadataIndex(parquet_path, ReadFooter(parquet_path), options);
+}
+
+void GenerateMetadataIndex(const char *parquet_path, const char *index_file_path, const GenerateMetadataIndexOptions &options)
+{
+    auto buffer = GenerateMetadataIndex(parquet_path, options);
+    WriteIndexFile(index_file_path, *buffer);
+}
+
+// Caps the estimated memory of the indexes that are generated at the same time
+class MemoryBudget
+{
+    std::mutex mutex;
+    std::condition_variable released;
+    int64_t limit;
+    int64_t used = 0;
+
+public:
+    explicit MemoryBudget(int64_t limit) : limit(limit) {}
+
+    // Blocks until the bytes fit, a request larger than the whole budget only waits until nothing else is reserved
+    void Acquire(int64_t bytes)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        released.wait(lock, [&]()
+                      { return used == 0 || used + bytes <= limit; });
+        used += bytes;
+    }
+
+    void Release(int64_t bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            used -= bytes;
+        }
+
+        released.notify_all();
+    }
+};
+
+std::vector<std::string> GenerateMetadataIndexes(const std::vector<std::pair<std::string, std::string>> &parquet_and_index_file_paths,
+                                                 uint32_t num_threads,
+                                                 int64_t memory_limit,
+                                                 const GenerateMetadataIndexOptions &options)
+{
+    std::vector<std::string> errors(parquet_and_index_file_paths.size());
+    MemoryBudget memory_budget(memory_limit);
+    std::atomic<size_t> next_file = 0;
+
+    // Files are taken one at a time from a shared counter, so a thread that got small files keeps taking more
+    auto worker = [&]()
+    {
+        for (auto i = next_file++; i < parquet_and_index_file_paths.size(); i = next_file++)
+        {
+            const auto &[parquet_path, index_file_path] = parquet_and_index_file_paths[i];
+            int64_t reserved = 0;
+            try
+            {
+                auto thrift_buffer = ReadFooter(parquet_path.c_str(), [&](uint32_t metadata_length)
+                                                {
+                                                    // The metadata, the offset tables and the index itself, the statistics
+                                                    // tables take less than the thrift statistics they come from
+                                                    reserved = (options.row_group_statistics || options.sorted_key_index || options.strip_ranges ? 4 : 3) * static_cast<int64_t>(metadata_length);
+                                                    memory_budget.Acquire(reserved); });
+                auto buffer = BuildMetadataIndex(parquet_path.c_str(), std::move(thrift_buffer), options);
+                WriteIndexFile(index_file_path.c_str(), *buffer);
+            }
+            catch (const std::exception &e)
+            {
+                errors[i] = e.what();
+                if (errors[i].empty())
+                    errors[i] = "Unknown error";
+            }
+
+            if (reserved > 0)
+                memory_budget.Release(reserved);
+        }
+    };
+
+    if (num_threads == 0)
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = std::min<size_t>(num_threads, parquet_and_index_file_paths.size());
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 1; t < num_threads; t++)
+        threads.emplace_back(worker);
+
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+
+    return errors;
+}
+
+struct IndexTables
+{
+    const uint32_t *num_row_offsets;
+    const uint8_t *row_numbers; // uint32 in PJ_2, int64 in PJ_3
+    const uint32_t *schema_offsets;
+    const uint32_t *schema_num_children_offsets;
+    const uint32_t *row_groups_offsets;
+    const uint32_t *column_orders_offsets;
+    const uint32_t *column_chunks_offsets;
+    const uint8_t *column_names;
+    const uint8_t *metadata;
+};
+
+// The column chunk offsets SpliceMetadata needs, gathered once per read from whichever table the index stores.
+// For every selected row group: the list header offset, the end of the last chunk and the begin and end of every
+// selected chunk, all relative to the row group.
+class ColumnChunksSelection
+{
+    size_t stride;
+    std::vector<uint32_t> offsets;
+
+public:
+    ColumnChunksSelection(size_t row_groups, size_t columns) : stride(2 + 2 * columns), offsets(columns > 0 ? row_groups * stride : 0) {}
+
+    size_t GetStride() const { return stride; }
+
+    // The entry of the (1 + c + 1) row group offsets that ends up at position slot of every selected row group
+    static uint64_t GetEntry(size_t slot, const DataHeader &dataHeader, const std::vector<uint32_t> &columns)
+    {
+        if (slot < 2)
+            return slot == 0 ? 0 : 1 + uint64_t(dataHeader.columns);
+
+        return 1 + uint64_t(columns[(slot - 2) / 2]) + slot % 2;
+    }
+
+    // chunks_list is the (1 + c + 1) offsets of the row group, a table row or a PackedColumnChunksRow
+    template <typename TRow>
+    void Gather(size_t idx, TRow &&chunks_list, const DataHeader &dataHeader, const std::vector<uint32_t> &columns)
+    {
+        auto selected = &offsets[idx * stride];
+        selected[0] = chunks_list[0];
+        selected[1] = chunks_list[1 + dataHeader.columns];
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            selected[2 + 2 * i] = chunks_list[1 + columns[i]];
+            selected[2 + 2 * i + 1] = chunks_list[1 + columns[i] + 1];
+        }
+    }
+
+    // entry_offsets is one entry of a column-major table, starting at first_row_group
+    void GatherColumn(size_t slot, const uint32_t *entry_offsets, uint32_t first_row_group, const std::vector<uint32_t> &selected_row_groups)
+    {
+        for (size_t idx = 0; idx < selected_row_groups.size(); idx++)
+            offsets[idx * stride + slot] = FROM_FILE_ENDIANESS(entry_offsets[selected_row_groups[idx] - first_row_group]);
+    }
+
+    const uint32_t *operator[](size_t idx) const { return &offsets[idx * stride]; }
+};
+
+// The row groups SpliceMetadata visits, in order
+std::vector<uint32_t> GetSelectedRowGroups(const DataHeader &dataHeader, const std::vector<uint32_t> &row_groups, bool schema_only)
+{
+    if (row_groups.size() > 0 || schema_only)
+        return row_groups;
+
+    std::vector<uint32_t> all_row_groups(dataHeader.row_groups);
+    std::iota(all_row_groups.begin(), all_row_groups.end(), 0);
+    return all_row_groups;
+}
+
+inline int64_t GetRowNumber(const DataHeader &dataHeader, const IndexTables &tables, size_t row_group)
+{
+    if (dataHeader.version == 2)
+        return FROM_FILE_ENDIANESS(arrow::util::SafeLoadAs<uint32_t>(&tables.row_numbers[row_group * sizeof(uint32_t)]));
+
+    return FROM_FILE_ENDIANESS(arrow::util::SafeLoadAs<int64_t>(&tables.row_numbers[row_group * sizeof(int64_t)]));
+}
+
+IndexTables GetIndexTables(const DataHeader &dataHeader, const uint8_t *data_body)
+{
+    IndexTables tables;
+    tables.num_row_offsets = (const uint32_t *)&data_body[0];
+    tables.row_numbers = (const uint8_t *)&tables.num_row_offsets[dataHeader.get_num_rows_offsets_size()];
+    tables.schema_offsets = (const uint32_t *)&tables.row_numbers[dataHeader.get_row_numbers_size() * dataHeader.get_row_number_size()];
+    tables.schema_num_children_offsets = &tables.schema_offsets[dataHeader.get_schema_offsets_size()];
+    tables.row_groups_offsets = &tables.schema_num_children_offsets[dataHeader.get_schema_num_children_offsets_size()];
+    tables.column_orders_offsets = &tables.row_groups_offsets[dataHeader.get_row_groups_offsets_size()];
+    tables.column_chunks_offsets = &tables.column_orders_offsets[dataHeader.get_column_orders_offsets_size()];
+    tables.column_names = (const uint8_t *)&tables.column_chunks_offsets[dataHeader.get_stored_column_chunks_offsets_size()];
+    tables.metadata = &tables.column_names[dataHeader.column_names_length];
+    return tables;
+}
+
+// Splices the schema list for the columns, from the list header to the end of the last schema element.
+// The columns of a nested schema come from schema_tree->GroupColumns, the groups above them are spliced with them.
+void SpliceSchema(ThriftCopyPlan &plan,
+                  const IndexTables &tables,
+                  const std::vector<uint32_t> &columns,
+                  const SchemaTree *schema_tree = nullptr)
+{
+    auto schema_list = &tables.schema_offsets[0];
+    auto schema_num_children_offsets = tables.schema_num_children_offsets;
+
+    if (schema_tree != nullptr)
+    {
+        auto selected_elements = schema_tree->GetSelectedElements(columns);
+        plan.WriteListBegin(thrift_compact::CT_STRUCT, selected_elements.size());
+        auto elements = &schema_list[1]; // The root is the first element
+        for (auto [element, num_children] : selected_elements)
+        {
+            auto num_children_offsets = &schema_num_children_offsets[2 * element];
+            if (num_children_offsets[1] == 0)
+            {
+                plan.CopyFrom(elements[element], elements[element + 1] - elements[element]);
+                continue;
+            }
+
+            // Write the number of selected children of the group
+            //> 5: optional i32 num_children;
+            plan.CopyFrom(elements[element], num_children_offsets[0]);
+            plan.WriteI32(num_children);
+            plan.CopyFrom(elements[element] + num_children_offsets[1], elements[element + 1] - elements[element] - num_children_offsets[1]);
+        }
+
+        return;
+    }
+
+    plan.WriteListBegin(thrift_compact::CT_STRUCT, columns.size() + 1); // one extra schema element for root
+    uint32_t index_src = schema_list[1]; // skip the list header and jump to the first schema element (which is the root element)
+
+    auto root_schema_element = &schema_list[1];
+    size_t toCopy = root_schema_element[0] + schema_num_children_offsets[0] - index_src;
+    plan.CopyFrom(index_src, toCopy);
+
+    // Write updated num children in the root element
+    //> 5: optional i32 num_children; 
+    plan.WriteI32(columns.size());
+    index_src = root_schema_element[0] + schema_num_children_offsets[1];
+    toCopy = root_schema_element[1] - index_src;
+    plan.CopyFrom(index_src, toCopy);
+
+    auto schema_elements = &schema_list[2];
+    for (auto column : columns)
+    {
+        toCopy = schema_elements[column + 1] - schema_elements[column];
+        plan.CopyFrom(schema_elements[column], toCopy);
+    }
+}
+
+// The length of the schema list in the metadata section, SpliceSchema replaces it
+uint32_t GetSchemaLength(const DataHeader &dataHeader, const IndexTables &tables)
+{
+    return tables.schema_offsets[2 + dataHeader.get_schema_elements()] - tables.schema_offsets[0];
+}
+
+// A key_value_metadata value replaced by the spliced metadata, e.g. the ARROW:schema of the selected columns
+struct KeyValueReplacement
+{
+    uint32_t begin = 0; // Range of the replaced value in the metadata section, including its length
+    uint32_t end = 0;
+    std::string value;
+};
+
+// Splices the selected parts of the thrift metadata into a ThriftCopyPlan
+// prepared_schema is the output of SpliceSchema for the columns, nullptr to splice the schema here.
+// strip_ranges are the begin and end of the fields left out of every selected column chunk, nullptr to copy the chunks whole.
+// schema_tree is the tree of a nested schema, see SpliceSchema.
+void SpliceMetadata(ThriftCopyPlan &thriftCopier,
+                    const DataHeader &dataHeader,
+                    const IndexTables &tables,
+                    const std::vector<uint32_t> &row_groups,
+                    const std::vector<uint32_t> &columns,
+                    const ColumnChunksSelection &column_chunks,
+                    const std::vector<uint8_t> *prepared_schema,
+                    bool schema_only,
+                    const KeyValueReplacement *replacement = nullptr,
+                    const uint32_t *strip_ranges = nullptr,
+                    const SchemaTree *schema_tree = nullptr)
+{
+    auto num_row_offsets = tables.num_row_offsets;
+    auto schema_offsets = tables.schema_offsets;
+    auto row_groups_offsets = tables.row_groups_offsets;
+    auto column_orders_offsets = tables.column_orders_offsets;
+
+    uint32_t index_src = 0;
+    size_t toCopy = 0;
+
+    if (columns.size() > 0)
+    {
+        //> 2:required list<SchemaElement> schema;
+        auto schema_list = &schema_offsets[0];
+        toCopy = schema_list[0] - index_src;
+        thriftCopier.CopyFrom(index_src, toCopy);
+
+        if (prepared_schema != nullptr)
+            thriftCopier.WriteBytes(prepared_schema->data(), prepared_schema->size());
+        else
+            SpliceSchema(thriftCopier, tables, columns, schema_tree);
+
+        index_src = schema_list[2 + dataHeader.get_schema_elements()];
+    }
+
+    auto row_group_filtering = row_groups.size() > 0 || schema_only;
+    if (row_group_filtering)
+    {
+        //> 3: required i64 num_rows
+        int64_t num_rows = 0;
+        for (auto row_group : row_groups)
+        {
+            num_rows += GetRowNumber(dataHeader, tables, row_group);
+        }
+
+        toCopy = num_row_offsets[0] - index_src;
+        thriftCopier.CopyFrom(index_src, toCopy);
+        index_src += toCopy;
+
+        thriftCopier.WriteI64(num_rows);
+        index_src = num_row_offsets[1];
+    }
+
+    if (row_group_filtering)
+    {
+        //> 4: required list<RowGroup> row_groups
+        auto row_groups_list = &row_groups_offsets[0];
+        toCopy = row_groups_list[0] - index_src;
+        thriftCopier.CopyFrom(index_src, toCopy);
+        index_src += toCopy;
+
+        thriftCopier.WriteListBegin(thrift_compact::CT_STRUCT, row_groups.size());
+        index_src = row_groups_list[1];
+    }
+    else
+    {
+        // Copy to here, including the list header
+        auto row_groups_list = &row_groups_offsets[0];
+        toCopy = row_groups_list[1] - index_src;
+        thriftCopier.CopyFrom(index_src, toCopy);
+        index_src += toCopy;
+    }
+
+    for (auto idx = 0u;; idx++)
+    {
+        size_t row_group_idx = 0;
+
+        if (row_group_filtering)
+        {
+            if (idx >= row_groups.size())
+                break;
+
+            row_group_idx = row_groups[idx];
+        }
+        else
+        {
+            if (idx >= dataHeader.row_groups)
+                break;
+
+            row_group_idx = idx;
+        }
+
+        auto row_group_offset = row_groups_offsets[1 + row_group_idx];
+        index_src = row_groups_offsets[1 + row_group_idx];
+        if (columns.size() > 0)
+        {
+            //> 1: required list<ColumnChunk> columns
+            auto chunks = column_chunks[idx];
+            toCopy = row_group_offset + chunks[0] - index_src;
+            thriftCopier.CopyFrom(index_src, toCopy);
+            thriftCopier.WriteListBegin(thrift_compact::CT_STRUCT, columns.size());
+
+            for (size_t i = 0; i < columns.size(); i++)
+            {
+                auto chunk_begin = chunks[2 + 2 * i];
+                auto chunk_length = chunks[2 + 2 * i + 1] - chunk_begin;
+                auto strip = strip_ranges != nullptr ? &strip_ranges[2 * (idx * columns.size() + i)] : nullptr;
+                if (strip != nullptr && strip[0] != strip[1])
+                {
+                    if (strip[0] > strip[1] || strip[1] >= chunk_length)
+                    {
+                        auto msg = std::string("Index strip ranges section is invalid!");
+                        throw std::logic_error(msg);
+                    }
+
+                    // The fields before and the end of the ColumnMetaData and of the ColumnChunk after them
+                    thriftCopier.CopyFrom(row_group_offset + chunk_begin, strip[0]);
+                    thriftCopier.CopyFrom(row_group_offset + chunk_begin + strip[1], chunk_length - strip[1]);
+                }
+                else
+                {
+                    thriftCopier.CopyFrom(row_group_offset + chunk_begin, chunk_length);
+                }
+            }
+
+            index_src = row_group_offset + chunks[1];
+            toCopy = row_groups_offsets[1 + row_group_idx + 1] - index_src;
+            thriftCopier.CopyFrom(index_src, toCopy);
+            index_src += toCopy;
+        }
+        else
+        {
+            toCopy = row_groups_offsets[1 + row_group_idx + 1] - index_src;
+            thriftCopier.CopyFrom(index_src, toCopy);
+            index_src += toCopy;
+        }
+    }
+
+    index_src = row_groups_offsets[1 + dataHeader.row_groups];
+
+    //> 5: optional list<KeyValue> key_value_metadata
+    if (replacement != nullptr)
+    {
+        toCopy = replacement->begin - index_src;
+        thriftCopier.CopyFrom(index_src, toCopy);
+        thriftCopier.WriteBinary(replacement->value);
+        index_src = replacement->end;
+    }
+
+    if (columns.size() > 0)
+    {
+        //> 7: optional list<ColumnOrder> column_orders;
+        if (column_orders_offsets[0] != 0)
+        {
+            auto column_orders_list = &column_orders_offsets[0];
+            toCopy = column_orders_list[0] - index_src;
+            thriftCopier.CopyFrom(index_src, toCopy);
+            index_src += toCopy;
+
+            thriftCopier.WriteListBegin(thrift_compact::CT_STRUCT, columns.size()); // one extra element for root
+            index_src = column_orders_list[1];
+
+            auto column_orders = &column_orders_offsets[1];
+            for (auto column : columns)
+            {
+                toCopy = column_orders[column + 1] - column_orders[column];
+                thriftCopier.CopyFrom(column_orders[column], toCopy);
+            }
+            index_src = column_orders[dataHeader.columns];
+        }
+    }
+
+    // Copy leftovers
+    toCopy = dataHeader.metadata_length - index_src;
+    thriftCopier.CopyFrom(index_src, toCopy);
+}
+
+void ValidateSelection(const DataHeader &dataHeader,
+                       const std::vector<uint32_t> &row_groups,
+                       const std::vector<uint32_t> &column_indices,
+                       const std::vector<std::string> &column_names)
+{
+    if (row_groups.size() > 0)
+    {
+        for (auto row_group : row_groups)
+        {
+            if (row_group >= dataHeader.row_groups)
+            {
+                auto msg = std::string("Requested row_group=") + std::to_string(row_group) + ", but only 0-" + std::to_string(dataHeader.row_groups - 1) + " are available!";
+                throw std::logic_error(msg);
+            }
+        }
+    }
+
+    if (column_indices.size() > 0)
+    {
+        if (column_names.size() > 0)
+        {
+            auto msg = std::string("Cannot specify both column indices and column names at the same time!");
+            throw std::logic_error(msg);
+        }
+
+        for (auto column : column_indices)
+        {
+            if (column >= dataHeader.columns)
+            {
+                auto msg = std::string("Requested column=") + std::to_string(column) + ", but only 0-" + std::to_string(dataHeader.columns - 1) + " are available!";
+                throw std::logic_error(msg);
+            }
+        }
+    }
+}
+
+std::unordered_map<std::string, uint32_t> ReadColumnsMap(const DataHeader &dataHeader, const uint8_t *column_names_ptr)
+{
+    auto column_names_end = column_names_ptr + dataHeader.column_names_length;
+    std::unordered_map<std::string, uint32_t> columns_map;
+    columns_map.reserve(dataHeader.get_schema_elements());
+    for (uint32_t c = 0; c < dataHeader.get_schema_elements(); c++)
+    {
+        std::string s = (const char *)column_names_ptr;
+        column_names_ptr += s.length() + 1;
+        columns_map[s] = c;
+    }
+
+    if (column_names_ptr != column_names_end)
+    {
+        auto msg = std::string("Internal error, when reading column names!");
+        throw std::logic_error(msg);
+    }
+
+    return columns_map;
+}
+
+std::vector<uint32_t> ResolveColumns(const std::unordered_map<std::string, uint32_t> &columns_map,
+                                     const std::vector<std::string> &column_names)
+{
+    std::vector<uint32_t> columns;
+    columns.reserve(column_names.size());
+    for (const auto &column_name : column_names)
+    {
+        auto kvp = columns_map.find(column_name);
+        if (kvp == columns_map.end())
+        {
+            auto msg = std::string("Couldn't find a column with a name '") + column_name + "'!";
+            throw std::logic_error(msg);
+        }
+
+        columns.emplace_back(kvp->second);
+    }
+
+    return columns;
+}
+
+namespace palletjack
+{
+
+// The negation of a comparison or a null test, a null satisfies neither a comparison nor its negation
+RowGroupFilter::Kind NegateComparison(RowGroupFilter::Kind kind)
+{
+    using Kind = RowGroupFilter::Kind;
+    switch (kind)
+    {
+    case Kind::Equal:
+        return Kind::NotEqual;
+    case Kind::NotEqual:
+        return Kind::Equal;
+    case Kind::Less:
+        return Kind::GreaterEqual;
+    case Kind::LessEqual:
+        return Kind::Greater;
+    case Kind::Greater:
+        return Kind::LessEqual;
+    case Kind::GreaterEqual:
+        return Kind::Less;
+    case Kind::IsNull:
+        return Kind::IsValid;
+    case Kind::IsValid:
+        return Kind::IsNull;
+    default:
+        return kind;
+    }
+}
+
+// The comparison with its operands swapped, 5 < a is a > 5
+RowGroupFilter::Kind MirrorComparison(RowGroupFilter::Kind kind)
+{
+    using Kind = RowGroupFilter::Kind;
+    switch (kind)
+    {
+    case Kind::Less:
+        return Kind::Greater;
+    case Kind::LessEqual:
+        return Kind::GreaterEqual;
+    case Kind::Greater:
+        return Kind::Less;
+    case Kind::GreaterEqual:
+        return Kind::LessEqual;
+    default:
+        return kind;
+    }
+}
+
+// Negations are pushed down to the comparisons, so the filter tree has no Not
+RowGroupFilter ConvertExpression(const arrow::compute::Expression &expression, bool negate)
+{
+    using Kind = RowGroupFilter::Kind;
+    RowGroupFilter filter;
+    if (auto field_ref = expression.field_ref())
+    {
+        // A boolean column used as a predicate
+        if (field_ref->name() != nullptr)
+        {
+            filter.kind = Kind::Equal;
+            filter.column = *field_ref->name();
+            filter.value = std::make_shared<arrow::BooleanScalar>(!negate);
+        }
+
+        return filter;
+    }
+
+    auto call = expression.call();
+    if (call == nullptr)
+        return filter;
+
+    const auto &name = call->function_name;
+    const auto &arguments = call->arguments;
+    if (name == "invert" && arguments.size() == 1)
+        return ConvertExpression(arguments[0], !negate);
+
+    if (name == "and" || name == "and_kleene" || name == "or" || name == "or_kleene")
+    {
+        filter.kind = (name.starts_with("and") != negate) ? Kind::And : Kind::Or;
+        for (const auto &argument : arguments)
+            filter.children.push_back(ConvertExpression(argument, negate));
+
+        return filter;
+    }
+
+    static const std::pair<std::string_view, Kind> comparisons[] = {
+        {"equal", Kind::Equal},
+        {"not_equal", Kind::NotEqual},
+        {"less", Kind::Less},
+        {"less_equal", Kind::LessEqual},
+        {"greater", Kind::Greater},
+        {"greater_equal", Kind::GreaterEqual},
+    };
+
+    for (const auto &[comparison_name, comparison_kind] : comparisons)
+    {
+        if (name != comparison_name || arguments.size() != 2)
+            continue;
+
+        auto kind = comparison_kind;
+        auto field = &arguments[0];
+        auto literal = &arguments[1];
+        if (field->field_ref() == nullptr)
+        {
+            std::swap(field, literal);
+            kind = MirrorComparison(kind);
+        }
+
+        if (field->field_ref() == nullptr || field->field_ref()->name() == nullptr || literal->literal() == nullptr || !literal->literal()->is_scalar())
+            return filter;
+
+        filter.kind = negate ? NegateComparison(kind) : kind;
+        filter.column = *field->field_ref()->name();
+        filter.value = literal->literal()->scalar();
+        return filter;
+    }
+
+    if (arguments.size() != 1 || arguments[0].field_ref() == nullptr || arguments[0].field_ref()->name() == nullptr)
+        return filter;
+
+    const auto &column = *arguments[0].field_ref()->name();
+    if (name == "is_null" || name == "is_valid")
+    {
+        // NaNs are not counted as nulls by the statistics
+        if (call->options != nullptr && strcmp(call->options->type_name(), arrow::compute::NullOptions::kTypeName) == 0 &&
+            static_cast<const arrow::compute::NullOptions &>(*call->options).nan_is_null)
+            return filter;
+
+        auto kind = name == "is_null" ? Kind::IsNull : Kind::IsValid;
+        filter.kind = negate ? NegateComparison(kind) : kind;
+        filter.column = column;
+        return filter;
+    }
+
+    if (name == "is_in" && !negate && call->options != nullptr && strcmp(call->options->type_name(), arrow::compute::SetLookupOptions::kTypeName) == 0)
+    {
+        const auto &value_set = static_cast<const arrow::compute::SetLookupOptions &>(*call->options).value_set;
+        if (!value_set.is_array() || value_set.null_count() > 0)
+            return filter;
+
+        auto values = value_set.make_array();
+        RowGroupFilter any_of;
+        any_of.kind = Kind::Or;
+        for (int64_t i = 0; i < values->length(); i++)
+        {
+            auto value = values->GetScalar(i);
+            if (!value.ok())
+                return filter;
+
+            RowGroupFilter equal;
+            equal.kind = Kind::Equal;
+            equal.column = column;
+            equal.value = value.MoveValueUnsafe();
+            any_of.children.push_back(std::move(equal));
+        }
+
+        return any_of;
+    }
+
+    return filter;
+}
+
+RowGroupFilter RowGroupFilter::FromExpression(const arrow::compute::Expression &expression)
+{
+    return ConvertExpression(expression, false);
+}
+
+// Converts a time value between units, false if it isn't a whole number of the target unit or overflows
+bool ConvertTimeUnit(int64_t value, arrow::TimeUnit::type from, arrow::TimeUnit::type to, int64_t &result)
+{
+    static const int64_t units_per_second[] = {1, 1000, 1000000, 1000000000}; // SECOND, MILLI, MICRO, NANO
+    if (to >= from)
+    {
+        auto factor = units_per_second[to] / units_per_second[from];
+        if (value > std::numeric_limits<int64_t>::max() / factor || value < std::numeric_limits<int64_t>::min() / factor)
+            return false;
+
+        result = value * factor;
+        return true;
+    }
+
+    auto divisor = units_per_second[from] / units_per_second[to];
+    if (value % divisor != 0)
+        return false;
+
+    result = value / divisor;
+    return true;
+}
+
+// The value of an integer literal (or of a float with an integer value), above_int64 is set for uint64 values that don't fit int64
+bool GetIntegerValue(const arrow::Scalar &value, int64_t &int64_value, bool &above_int64)
+{
+    above_int64 = false;
+    switch (value.type->id())
+    {
+    case arrow::Type::INT8:
+        int64_value = static_cast<const arrow::Int8Scalar &>(value).value;
+        return true;
+    case arrow::Type::INT16:
+        int64_value = static_cast<const arrow::Int16Scalar &>(value).value;
+        return true;
+    case arrow::Type::INT32:
+        int64_value = static_cast<const arrow::Int32Scalar &>(value).value;
+        return true;
+    case arrow::Type::INT64:
+        int64_value = static_cast<const arrow::Int64Scalar &>(value).value;
+        return true;
+    case arrow::Type::UINT8:
+        int64_value = static_cast<const arrow::UInt8Scalar &>(value).value;
+        return true;
+    case arrow::Type::UINT16:
+        int64_value = static_cast<const arrow::UInt16Scalar &>(value).value;
+        return true;
+    case arrow::Type::UINT32:
+        int64_value = static_cast<const arrow::UInt32Scalar &>(value).value;
+        return true;
+    case arrow::Type::UINT64:
+    {
+        auto uint64_value = static_cast<const arrow::UInt64Scalar &>(value).value;
+        int64_value = static_cast<int64_t>(uint64_value);
+        above_int64 = uint64_value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        return true;
+    }
+    case arrow::Type::FLOAT:
+    case arrow::Type::DOUBLE:
+    {
+        double double_value = value.type->id() == arrow::Type::FLOAT ? static_cast<const arrow::FloatScalar &>(value).value
+                                                                     : static_cast<const arrow::DoubleScalar &>(value).value;
+        if (!(double_value >= -0x1p63 && double_value < 0x1p63) || std::trunc(double_value) != double_value)
+            return false;
+
+        int64_value = static_cast<int64_t>(double_value);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// Encodes a filter value the way the statistics of a column of column_type are encoded,
+// nullopt if it can't be compared with them exactly
+std::optional<uint64_t> EncodeFilterValue(StatisticsType statistics_type, const arrow::DataType &column_type, const arrow::Scalar &value)
+{
+    if (!value.is_valid)
+        return std::nullopt;
+
+    switch (statistics_type)
+    {
+    case StatisticsType::Int64:
+    case StatisticsType::UInt64:
+    {
+        int64_t int64_value;
+        bool above_int64 = false;
+        switch (column_type.id())
+        {
+        case arrow::Type::TIMESTAMP:
+            if (value.type->id() != arrow::Type::TIMESTAMP ||
+                !ConvertTimeUnit(static_cast<const arrow::TimestampScalar &>(value).value,
+                                 static_cast<const arrow::TimestampType &>(*value.type).unit(),
+                                 static_cast<const arrow::TimestampType &>(column_type).unit(),
+                                 int64_value))
+                return std::nullopt;
+            break;
+        case arrow::Type::TIME32:
+        case arrow::Type::TIME64:
+        {
+            if (value.type->id() != arrow::Type::TIME32 && value.type->id() != arrow::Type::TIME64)
+                return std::nullopt;
+
+            int64_t time = value.type->id() == arrow::Type::TIME32 ? static_cast<const arrow::Time32Scalar &>(value).value
+                                                                   : static_cast<const arrow::Time64Scalar &>(value).value;
+            if (!ConvertTimeUnit(time, static_cast<const arrow::TimeType &>(*value.type).unit(), static_cast<const arrow::TimeType &>(column_type).unit(), int64_value))
+                return std::nullopt;
+            break;
+        }
+        case arrow::Type::DATE32:
+            if (value.type->id() == arrow::Type::DATE32)
+            {
+                int64_value = static_cast<const arrow::Date32Scalar &>(value).value;
+            }
+            else if (value.type->id() == arrow::Type::DATE64)
+            {
+                constexpr int64_t kMillisecondsPerDay = 86400000;
+                int64_value = static_cast<const arrow::Date64Scalar &>(value).value;
+                if (int64_value % kMillisecondsPerDay != 0)
+                    return std::nullopt;
+                int64_value /= kMillisecondsPerDay;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+            break;
+        case arrow::Type::BOOL:
+            if (value.type->id() != arrow::Type::BOOL)
+                return std::nullopt;
+            int64_value = static_cast<const arrow::BooleanScalar &>(value).value;
+            break;
+        default:
+            // Decimals are stored as their unscaled integers, they are only compared with integer columns
+            if (!arrow::is_integer(column_type.id()) || !GetIntegerValue(value, int64_value, above_int64))
+                return std::nullopt;
+        }
+
+        if (statistics_type == StatisticsType::Int64)
+            return above_int64 ? std::nullopt : std::optional<uint64_t>(static_cast<uint64_t>(int64_value));
+
+        if (!above_int64 && int64_value < 0)
+            return std::nullopt;
+        return static_cast<uint64_t>(int64_value);
+    }
+    case StatisticsType::Double:
+    {
+        double double_value;
+        int64_t int64_value;
+        bool above_int64;
+        if (value.type->id() == arrow::Type::FLOAT)
+            double_value = static_cast<const arrow::FloatScalar &>(value).value;
+        else if (value.type->id() == arrow::Type::DOUBLE)
+            double_value = static_cast<const arrow::DoubleScalar &>(value).value;
+        else if (GetIntegerValue(value, int64_value, above_int64) && !above_int64 && int64_value >= -(int64_t(1) << 53) && int64_value <= (int64_t(1) << 53))
+            double_value = static_cast<double>(int64_value);
+        else
+            return std::nullopt;
+
+        if (std::isnan(double_value))
+            return std::nullopt;
+        return std::bit_cast<uint64_t>(double_value);
+    }
+    case StatisticsType::BytesPrefix:
+    {
+        uint64_t encoded;
+        if (!arrow::is_base_binary_like(value.type->id()) && !arrow::is_binary_view_like(value.type->id()) && value.type->id() != arrow::Type::FIXED_SIZE_BINARY)
+            return std::nullopt;
+
+        EncodeStatisticsValue(statistics_type, parquet::Type::BYTE_ARRAY, static_cast<const arrow::BaseBinaryScalar &>(value).view(), encoded);
+        return encoded;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+// Evaluates a RowGroupFilter over the row group statistics of its columns, a keep flag per row group
+class RowGroupFilterEvaluator
+{
+    struct FilterColumn
+    {
+        ColumnStatistics statistics;
+        std::shared_ptr<arrow::DataType> type; // nullptr if the column has no Arrow type
+    };
+
+    uint32_t row_groups;
+    const int64_t *row_offsets; // rg + 1
+    std::unordered_map<std::string, FilterColumn> columns;
+
+    // Rows without statistics are kept, unless they are all nulls, which satisfy no comparison
+    void KeepRowGroupsWithoutMinMax(const ColumnStatistics &statistics, uint8_t *keep) const
+    {
+        auto has_min_max = statistics.has_min_max->data();
+        auto has_null_count = statistics.has_null_count->data();
+        auto null_counts = statistics.null_count->data();
+        for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+        {
+            if (arrow::bit_util::GetBit(has_min_max, row_group))
+                continue;
+
+            keep[row_group] = !arrow::bit_util::GetBit(has_null_count, row_group) ||
+                              arrow::util::SafeLoadAs<int64_t>(null_counts + row_group * sizeof(int64_t)) != row_offsets[row_group + 1] - row_offsets[row_group];
+        }
+    }
+
+    // One tight loop per comparison, so the compiler can vectorize it
+    template <typename T, typename TPredicate>
+    void CompareValues(const std::shared_ptr<arrow::Buffer> &values, uint8_t *keep, TPredicate predicate) const
+    {
+        auto data = values->data();
+        for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+            keep[row_group] = predicate(arrow::util::SafeLoadAs<T>(data + row_group * sizeof(T)));
+    }
+
+    // exact is false for the prefixes, which only prove an order when they differ
+    template <typename T>
+    void Compare(RowGroupFilter::Kind kind, const ColumnStatistics &statistics, T value, bool exact, bool can_prune_not_equal, uint8_t *keep) const
+    {
+        using Kind = RowGroupFilter::Kind;
+        switch (kind)
+        {
+        case Kind::Equal:
+        {
+            std::vector<uint8_t> max_keep(row_groups);
+            CompareValues<T>(statistics.min, keep, [=](T min)
+                             { return min <= value; });
+            CompareValues<T>(statistics.max, max_keep.data(), [=](T max)
+                             { return max >= value; });
+            for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+                keep[row_group] &= max_keep[row_group];
+            break;
+        }
+        case Kind::NotEqual:
+        {
+            if (!exact || !can_prune_not_equal)
+            {
+                std::fill(keep, keep + row_groups, 1);
+                return;
+            }
+
+            // Only a row group with a single value equal to value is pruned
+            std::vector<uint8_t> max_keep(row_groups);
+            CompareValues<T>(statistics.min, keep, [=](T min)
+                             { return min != value; });
+            CompareValues<T>(statistics.max, max_keep.data(), [=](T max)
+                             { return max != value; });
+            for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+                keep[row_group] |= max_keep[row_group];
+            break;
+        }
+        case Kind::Less:
+            if (exact)
+                CompareValues<T>(statistics.min, keep, [=](T min)
+                                 { return min < value; });
+            else
+                CompareValues<T>(statistics.min, keep, [=](T min)
+                                 { return min <= value; });
+            break;
+        case Kind::LessEqual:
+            CompareValues<T>(statistics.min, keep, [=](T min)
+                             { return min <= value; });
+            break;
+        case Kind::Greater:
+            if (exact)
+                CompareValues<T>(statistics.max, keep, [=](T max)
+                                 { return max > value; });
+            else
+                CompareValues<T>(statistics.max, keep, [=](T max)
+                                 { return max >= value; });
+            break;
+        case Kind::GreaterEqual:
+            CompareValues<T>(statistics.max, keep, [=](T max)
+                             { return max >= value; });
+            break;
+        default:
+            break;
+        }
+
+        KeepRowGroupsWithoutMinMax(statistics, keep);
+    }
+
+    void EvaluateColumn(const RowGroupFilter &filter, uint8_t *keep) const
+    {
+        using Kind = RowGroupFilter::Kind;
+        std::fill(keep, keep + row_groups, 1);
+        const auto &column = columns.at(filter.column);
+        const auto &statistics = column.statistics;
+        if (statistics.type == StatisticsType::None)
+            return;
+
+        auto has_null_count = statistics.has_null_count->data();
+        auto null_counts = statistics.null_count->data();
+        if (filter.kind == Kind::IsNull)
+        {
+            for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+                keep[row_group] = !arrow::bit_util::GetBit(has_null_count, row_group) || arrow::util::SafeLoadAs<int64_t>(null_counts + row_group * sizeof(int64_t)) > 0;
+            return;
+        }
+
+        if (filter.kind == Kind::IsValid)
+        {
+            // A row group with a min and max has values, the others have them unless all their rows are nulls
+            std::fill(keep, keep + row_groups, 0);
+            KeepRowGroupsWithoutMinMax(statistics, keep);
+            auto has_min_max = statistics.has_min_max->data();
+            for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+                keep[row_group] |= arrow::bit_util::GetBit(has_min_max, row_group);
+            return;
+        }
+
+        if (filter.value == nullptr || column.type == nullptr)
+            return;
+
+        auto value = EncodeFilterValue(statistics.type, *column.type, *filter.value);
+        if (!value)
+            return;
+
+        switch (statistics.type)
+        {
+        case StatisticsType::Int64:
+            Compare<int64_t>(filter.kind, statistics, static_cast<int64_t>(*value), true, true, keep);
+            break;
+        case StatisticsType::UInt64:
+            Compare<uint64_t>(filter.kind, statistics, *value, true, true, keep);
+            break;
+        case StatisticsType::Double:
+            // NaNs are left out of the statistics, and they are not equal to anything
+            Compare<double>(filter.kind, statistics, std::bit_cast<double>(*value), true, false, keep);
+            break;
+        case StatisticsType::BytesPrefix:
+            Compare<uint64_t>(filter.kind, statistics, *value, false, false, keep);
+            break;
+        default:
+            break;
+        }
+    }
+
+public:
+    RowGroupFilterEvaluator(uint32_t row_groups, const std::vector<int64_t> &row_offsets) : row_groups(row_groups), row_offsets(row_offsets.data()) {}
+
+    void AddColumn(const std::string &name, ColumnStatistics statistics, std::shared_ptr<arrow::DataType> type)
+    {
+        columns[name] = {std::move(statistics), std::move(type)};
+    }
+
+    std::vector<uint8_t> Evaluate(const RowGroupFilter &filter) const
+    {
+        using Kind = RowGroupFilter::Kind;
+        std::vector<uint8_t> keep(row_groups, 1);
+        switch (filter.kind)
+        {
+        case Kind::Any:
+            break;
+        case Kind::And:
+            for (const auto &child : filter.children)
+            {
+                auto child_keep = Evaluate(child);
+                for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+                    keep[row_group] &= child_keep[row_group];
+            }
+            break;
+        case Kind::Or:
+            std::fill(keep.begin(), keep.end(), 0);
+            for (const auto &child : filter.children)
+            {
+                auto child_keep = Evaluate(child);
+                for (uint32_t row_group = 0; row_group < row_groups; row_group++)
+                    keep[row_group] |= child_keep[row_group];
+            }
+            break;
+        default:
+            EvaluateColumn(filter, keep.data());
+        }
+
+        return keep;
+    }
+};
+
+// The columns of the comparisons and null tests of a filter, each once
+void GetFilterColumns(const RowGroupFilter &filter, std::vector<std::string> &columns)
+{
+    if (filter.kind == RowGroupFilter::Kind::And || filter.kind == RowGroupFilter::Kind::Or)
+    {
+        for (const auto &child : filter.children)
+            GetFilterColumns(child, columns);
+    }
+    else if (filter.kind != RowGroupFilter::Kind::Any && std::find(columns.begin(), columns.end(), filter.column) == columns.end())
+    {
+        columns.push_back(filter.column);
+    }
+}
+
+class PreparedSelectionImpl : public PreparedSelection
+{
+public:
+    std::vector<uint32_t> columns;
+    // Of the index the selection was prepared with, checked against the indexes it is used with
+    uint32_t index_columns;
+    uint32_t schema_length;
+    std::vector<uint8_t> schema; // SpliceSchema output, empty if all columns are selected
+
+    const std::vector<uint32_t> &column_indices() const override { return columns; }
+};
+
+// Common part of the index readers, they only differ in how the offset tables and the thrift metadata are loaded
+class IndexReaderBase : public IndexReader
+{
+    mutable std::once_flag columns_map_flag;
+    mutable std::unordered_map<std::string, uint32_t> columns_map;
+    mutable std::optional<ColumnNamesHash> columns_hash;
+    mutable std::once_flag row_offsets_flag;
+    mutable std::vector<int64_t> row_offsets; // rg + 1, the first row of every row group and the number of rows
+    mutable std::once_flag statistics_flag;
+    mutable const ExtensionSection *statistics_section = nullptr;
+    mutable std::shared_ptr<arrow::Buffer> statistics_types;
+    mutable std::optional<RowGroupStatistics> statistics;
+    mutable std::once_flag sorted_key_flag;
+    mutable std::shared_ptr<arrow::Buffer> sorted_key_data;
+    mutable std::optional<SortedKey> sorted_key;
+    mutable std::once_flag arrow_schema_flag;
+    mutable KeyValueReplacement arrow_schema_value; // The range of the ARROW:schema value, value is unused
+    mutable std::shared_ptr<arrow::Schema> arrow_schema; // nullptr if the metadata has no ARROW:schema with a field per column
+    mutable std::once_flag schema_tree_flag;
+    mutable std::optional<SchemaTree> schema_tree; // Indexes with FLAG_NESTED_SCHEMA only
+
+    const std::vector<int64_t> &GetRowOffsets() const
+    {
+        std::call_once(row_offsets_flag, [this]()
+                       {
+                           row_offsets.resize(dataHeader.row_groups + 1);
+                           row_offsets[0] = 0;
+                           for (uint32_t row_group = 0; row_group < dataHeader.row_groups; row_group++)
+                               row_offsets[row_group + 1] = row_offsets[row_group] + GetRowNumber(dataHeader, tables, row_group); });
+
+        return row_offsets;
+    }
+
+protected:
+    struct ColumnNamesSections
+    {
+        const uint8_t *column_names;
+        const uint8_t *column_names_hash; // nullptr if the index has no column names hash section
+        uint64_t column_names_hash_length;
+    };
+
+    DataHeader dataHeader;
+    std::vector<ExtensionSection> extension_sections;
+    IndexTables tables; // Set by the derived class
+    // Set for indexes with FLAG_PACKED_COLUMN_CHUNKS_OFFSETS, by the derived class
+    std::optional<PackedColumnChunksOffsets> packed_offsets;
+    const ExtensionSection *packed_offsets_section = nullptr;
+
+    IndexReaderBase(const DataHeader &dataHeader, std::vector<ExtensionSection> extension_sections)
+        : dataHeader(dataHeader), extension_sections(std::move(extension_sections))
+    {
+        if (dataHeader.has_packed_column_chunks_offsets())
+        {
+            packed_offsets_section = FindExtensionSection(this->extension_sections, ExtensionSectionId::PackedColumnChunksOffsets);
+            if (packed_offsets_section == nullptr || packed_offsets_section->length < PackedColumnChunksOffsets::GetRowGroupOffsetsLength(dataHeader))
+            {
+                auto msg = std::string("Index packed column chunks offsets section is invalid!");
+                throw std::logic_error(msg);
+            }
+        }
+    }
+
+    // Called at most once, the first time a column is selected by name
+    virtual ColumnNamesSections LoadColumnNames() const = 0;
+    // Gathers the column chunk offsets of a selection, see GatherColumnChunks
+    virtual ColumnChunksSelection LoadColumnChunks(const std::vector<uint32_t> &selected_row_groups, const std::vector<uint32_t> &columns) const = 0;
+    // Executes the plan against the metadata section
+    virtual std::shared_ptr<arrow::Buffer> CopyMetadata(const ThriftCopyPlan &plan) const = 0;
+    // Reads a range of the index, for the extension sections that are loaded on demand
+    virtual std::shared_ptr<arrow::Buffer> ReadIndexRange(uint64_t offset, uint64_t length) const = 0;
+
+    // The types of the row group statistics are loaded the first time they are read
+    const RowGroupStatistics &GetRowGroupStatistics() const
+    {
+        std::call_once(statistics_flag, [this]()
+                       {
+                           statistics_section = FindExtensionSection(extension_sections, ExtensionSectionId::RowGroupStatistics);
+                           if (statistics_section == nullptr)
+                           {
+                               auto msg = std::string("The index has no row group statistics, it needs to be generated with row_group_statistics!");
+                               throw std::logic_error(msg);
+                           }
+
+                           auto types_length = RowGroupStatistics::GetTypesLength(dataHeader);
+                           if (statistics_section->length < types_length)
+                           {
+                               auto msg = std::string("Index row group statistics section is invalid!");
+                               throw std::logic_error(msg);
+                           }
+
+                           statistics_types = ReadIndexRange(statistics_section->offset, types_length);
+                           statistics.emplace(dataHeader, statistics_types->data(), statistics_section->length); });
+
+        return *statistics;
+    }
+
+    // The sorted key section is loaded the first time it is searched, a binary search touches only a few of its pages
+    const SortedKey &GetSortedKey() const
+    {
+        std::call_once(sorted_key_flag, [this]()
+                       {
+                           auto section = FindExtensionSection(extension_sections, ExtensionSectionId::SortedKey);
+                           if (section == nullptr)
+                           {
+                               auto msg = std::string("The index has no sorted key, it needs to be generated with sorted_key_index!");
+                               throw std::logic_error(msg);
+                           }
+
+                           sorted_key_data = ReadIndexRange(section->offset, section->length);
+                           sorted_key.emplace(dataHeader, sorted_key_data->data(), section->length); });
+
+        return *sorted_key;
+    }
+
+    // The ARROW:schema written by Arrow covers every column, it is found and decoded the first time a read projects it
+    const std::shared_ptr<arrow::Schema> &GetArrowSchema() const
+    {
+        std::call_once(arrow_schema_flag, [this]()
+                       {
+                           // The fields of a nested schema aren't its columns, its ARROW:schema is copied as it is
+                           if (dataHeader.has_nested_schema())
+                               return;
+
+                           // The key_value_metadata follows the row groups, only the metadata after them is read
+                           auto start = tables.row_groups_offsets[1 + dataHeader.row_groups];
+                           auto metadata_offset = dataHeader.get_index_size() - dataHeader.metadata_length;
+                           auto tail = ReadIndexRange(metadata_offset + start, dataHeader.metadata_length - start);
+                           MetadataOffsets unused;
+                           uint32_t value_begin = 0;
+                           std::string_view value;
+                           if (!ThriftOffsetScanner(tail->data(), tail->size(), unused).FindKeyValue("ARROW:schema", value_begin, value))
+                               return;
+
+                           // Same decoding as parquet::arrow, a schema it can't decode is left as it is
+                           auto decoded = arrow::util::base64_decode(value);
+                           if (!decoded.ok())
+                               return;
+
+                           arrow::io::BufferReader input(arrow::Buffer::FromString(decoded.MoveValueUnsafe()));
+                           arrow::ipc::DictionaryMemo dictionary_memo;
+                           auto schema = arrow::ipc::ReadSchema(&input, &dictionary_memo);
+                           if (!schema.ok() || (*schema)->num_fields() != static_cast<int>(dataHeader.columns))
+                               return;
+
+                           arrow_schema_value.begin = start + value_begin;
+                           arrow_schema_value.end = start + (reinterpret_cast<const uint8_t *>(value.data()) + value.size() - tail->data());
+                           arrow_schema = schema.MoveValueUnsafe(); });
+
+        return arrow_schema;
+    }
+
+    // The ARROW:schema of the selected columns, nullopt if the metadata has none to project
+    std::optional<KeyValueReplacement> ProjectArrowSchema(const std::vector<uint32_t> &columns) const
+    {
+        const auto &schema = GetArrowSchema();
+        if (schema == nullptr)
+            return std::nullopt;
+
+        arrow::FieldVector fields;
+        fields.reserve(columns.size());
+        for (auto column : columns)
+            fields.push_back(schema->field(column));
+
+        std::shared_ptr<arrow::Buffer> serialized;
+        PARQUET_ASSIGN_OR_THROW(serialized, arrow::ipc::SerializeSchema(arrow::Schema(std::move(fields), schema->metadata())));
+        auto projection = arrow_schema_value;
+        projection.value = arrow::util::base64_encode(std::string_view(*serialized));
+        return projection;
+    }
+
+    // The strip ranges of the selected column chunks, 2 per chunk in the order SpliceMetadata visits them
+    std::vector<uint32_t> LoadStripRanges(const std::vector<uint32_t> &selected_row_groups, const std::vector<uint32_t> &columns) const
+    {
+        auto section = FindExtensionSection(extension_sections, ExtensionSectionId::StripRanges);
+        if (section == nullptr)
+        {
+            auto msg = std::string("The index has no strip ranges, it needs to be generated with strip_ranges!");
+            throw std::logic_error(msg);
+        }
+
+        StripRanges::Validate(dataHeader, section->length);
+        std::vector<uint32_t> strip_ranges(selected_row_groups.size() * columns.size() * 2);
+        if (strip_ranges.size() == 0)
+            return strip_ranges;
+
+        // Only the span of the selected columns is read from every row group
+        auto [first_column, last_column] = std::minmax_element(columns.begin(), columns.end());
+        for (size_t idx = 0; idx < selected_row_groups.size(); idx++)
+        {
+            auto range = StripRanges::GetRange(dataHeader, selected_row_groups[idx], *first_column, *last_column);
+            auto data = ReadIndexRange(section->offset + range.first, range.second);
+            StripRanges row_group_ranges(data->data(), *first_column);
+            for (size_t i = 0; i < columns.size(); i++)
+            {
+                auto [begin, end] = row_group_ranges.Get(columns[i]);
+                strip_ranges[2 * (idx * columns.size() + i)] = begin;
+                strip_ranges[2 * (idx * columns.size() + i) + 1] = end;
+            }
+        }
+
+        return strip_ranges;
+    }
+
+    std::shared_ptr<arrow::Buffer> SpliceSelection(const std::vector<uint32_t> &row_groups,
+                                                   const std::vector<uint32_t> &selected_columns,
+                                                   const std::vector<uint8_t> *prepared_schema,
+                                                   bool schema_only,
+                                                   bool project_arrow_schema,
+                                                   bool strip) const
+    {
+        auto arrow_schema_projection = project_arrow_schema && selected_columns.size() > 0 ? ProjectArrowSchema(selected_columns) : std::nullopt;
+
+        // Stripping goes chunk by chunk, so no columns selects all of them explicitly
+        std::vector<uint32_t> all_columns;
+        if (strip && selected_columns.size() == 0)
+        {
+            all_columns.resize(dataHeader.columns);
+            std::iota(all_columns.begin(), all_columns.end(), 0);
+        }
+
+        const auto &columns = all_columns.size() > 0 ? all_columns : selected_columns;
+        auto selected_row_groups = GetSelectedRowGroups(dataHeader, row_groups, schema_only);
+        auto column_chunks = LoadColumnChunks(selected_row_groups, columns);
+        auto strip_ranges = strip ? LoadStripRanges(selected_row_groups, columns) : std::vector<uint32_t>();
+
+        // The plan knows the exact output size, so we don't allocate (and touch) a buffer as big as the whole metadata section
+        ThriftCopyPlan plan;
+        SpliceMetadata(plan, dataHeader, tables, row_groups, columns, column_chunks, prepared_schema, schema_only,
+                       arrow_schema_projection ? &*arrow_schema_projection : nullptr, strip ? strip_ranges.data() : nullptr, GetSchemaTree());
+        auto metadata = CopyMetadata(plan);
+
+#ifdef DEBUG
+        std::cerr << " Reading thrift length: " << dataHeader.metadata_length << std::endl;
+        std::cerr << " Spliced thrift length: " << metadata->size() << std::endl;
+#endif
+
+        return metadata;
+    }
+
+    static std::shared_ptr<::parquet::FileMetaData> ParseMetadata(const std::shared_ptr<arrow::Buffer> &metadata)
+    {
+        uint32_t length = metadata->size();
+        return ::parquet::FileMetaData::Make(metadata->data(), &length);
+    }
+
+    // The tree of a nested schema, nullptr if the schema is flat
+    const SchemaTree *GetSchemaTree() const
+    {
+        if (!dataHeader.has_nested_schema())
+            return nullptr;
+
+        std::call_once(schema_tree_flag, [this]()
+                       {
+                           // The num_children and the map annotations of the groups are scanned from the schema list,
+                           // which is O(schema elements)
+                           auto elements = dataHeader.get_schema_elements();
+                           auto schema_begin = tables.schema_offsets[1];
+                           auto schema_end = tables.schema_offsets[2 + elements];
+                           if (schema_end < schema_begin)
+                           {
+                               auto msg = std::string("Index schema is invalid!");
+                               throw std::logic_error(msg);
+                           }
+
+                           auto metadata_offset = dataHeader.get_index_size() - dataHeader.metadata_length;
+                           auto schema = ReadIndexRange(metadata_offset + schema_begin, schema_end - schema_begin);
+                           MetadataOffsets schema_offsets;
+                           ThriftOffsetScanner(schema->data(), schema->size(), schema_offsets).ScanSchemaElements(1 + elements);
+                           schema_tree.emplace(schema_offsets.schema_num_children, schema_offsets.schema_map_groups, dataHeader.columns); });
+
+        return &*schema_tree;
+    }
+
+    std::vector<uint32_t> GetColumns(const std::vector<uint32_t> &column_indices, const std::vector<std::string> &column_names) const
+    {
+        auto tree = GetSchemaTree();
+        if (column_names.size() == 0)
+            return tree != nullptr ? tree->GroupColumns(column_indices) : column_indices;
+
+        std::call_once(columns_map_flag, [this]()
+                       {
+                           auto sections = LoadColumnNames();
+                           if (sections.column_names_hash != nullptr)
+                               columns_hash.emplace(dataHeader, sections.column_names, sections.column_names_hash, sections.column_names_hash_length);
+                           else
+                               columns_map = ReadColumnsMap(dataHeader, sections.column_names); });
+
+        auto columns = columns_hash ? columns_hash->ResolveColumns(column_names) : ResolveColumns(columns_map, column_names);
+        if (tree == nullptr)
+            return columns;
+
+        // The names of a nested schema are the paths of its elements, a group selects all of its columns
+        std::vector<uint32_t> group_columns;
+        for (auto element : columns)
+        {
+            auto [first_column, end_column] = tree->GetColumns(element + 1);
+            for (auto column = first_column; column < end_column; column++)
+                group_columns.push_back(column);
+        }
+
+        return tree->GroupColumns(group_columns);
+    }
+
+    // Range of the stored column chunk offsets of a row group, relative to the start of the table or the packed section
+    std::pair<uint64_t, uint64_t> GetColumnChunksRowRange(uint32_t row_group) const
+    {
+        if (packed_offsets)
+            return packed_offsets->GetRowGroupRange(row_group);
+
+        auto row_length = (1 + uint64_t(dataHeader.columns) + 1) * sizeof(uint32_t);
+        return {row_group * row_length, row_length};
+    }
+
+    // Range of an entry of a column-major table, for the row groups first_row_group..last_row_group
+    std::pair<uint64_t, uint64_t> GetColumnChunksEntryRange(uint64_t entry, uint32_t first_row_group, uint32_t last_row_group) const
+    {
+        return {(entry * dataHeader.row_groups + first_row_group) * sizeof(uint32_t), (uint64_t(last_row_group) - first_row_group + 1) * sizeof(uint32_t)};
+    }
+
+    // The ranges of the stored column chunk offsets GatherColumnChunks reads for a selection
+    std::vector<std::pair<uint64_t, uint64_t>> GetColumnChunksRanges(const std::vector<uint32_t> &selected_row_groups, const std::vector<uint32_t> &columns) const
+    {
+        std::vector<std::pair<uint64_t, uint64_t>> ranges;
+        if (columns.size() == 0 || selected_row_groups.size() == 0)
+            return ranges;
+
+        if (dataHeader.has_column_major_column_chunks_offsets())
+        {
+            auto [first_row_group, last_row_group] = std::minmax_element(selected_row_groups.begin(), selected_row_groups.end());
+            for (size_t slot = 0; slot < 2 + 2 * columns.size(); slot++)
+                ranges.push_back(GetColumnChunksEntryRange(ColumnChunksSelection::GetEntry(slot, dataHeader, columns), *first_row_group, *last_row_group));
+
+            return ranges;
+        }
+
+        for (auto row_group : selected_row_groups)
+            ranges.push_back(GetColumnChunksRowRange(row_group));
+
+        return ranges;
+    }
+
+    // TRead(offset, length) returns the stored column chunk offsets of a range returned by GetColumnChunksRanges
+    template <typename TRead>
+    ColumnChunksSelection GatherColumnChunks(const std::vector<uint32_t> &selected_row_groups, const std::vector<uint32_t> &columns, TRead read) const
+    {
+        ColumnChunksSelection column_chunks(selected_row_groups.size(), columns.size());
+        if (columns.size() == 0 || selected_row_groups.size() == 0)
+            return column_chunks;
+
+        if (dataHeader.has_column_major_column_chunks_offsets())
+        {
+            // A column at a time, so a narrow selection over many row groups reads contiguous memory
+            auto [first_row_group, last_row_group] = std::minmax_element(selected_row_groups.begin(), selected_row_groups.end());
+            for (size_t slot = 0; slot < column_chunks.GetStride(); slot++)
+            {
+                auto range = GetColumnChunksEntryRange(ColumnChunksSelection::GetEntry(slot, dataHeader, columns), *first_row_group, *last_row_group);
+                column_chunks.GatherColumn(slot, (const uint32_t *)read(range.first, range.second), *first_row_group, selected_row_groups);
+            }
+
+            return column_chunks;
+        }
+
+        for (size_t idx = 0; idx < selected_row_groups.size(); idx++)
+        {
+            auto range = GetColumnChunksRowRange(selected_row_groups[idx]);
+            auto data = read(range.first, range.second);
+            if (packed_offsets)
+                column_chunks.Gather(idx, PackedColumnChunksRow(dataHeader, data, range.second), dataHeader, columns);
+            else
+                column_chunks.Gather(idx, (const uint32_t *)data, dataHeader, columns);
+        }
+
+        return column_chunks;
+    }
+
+public:
+    uint32_t num_row_groups() const override { return dataHeader.row_groups; }
+    uint32_t num_columns() const override { return dataHeader.columns; }
+    int64_t num_rows() const override { return GetRowOffsets().back(); }
+
+    RowRangeSelection FindRowGroups(int64_t start, int64_t stop) const override
+    {
+        const auto &offsets = GetRowOffsets();
+        if (start < 0 || start >= stop || stop > offsets.back())
+        {
+            auto msg = std::string("Requested rows=[") + std::to_string(start) + ", " + std::to_string(stop) + "), but only rows=[0, " + std::to_string(offsets.back()) + ") are available!";
+            throw std::logic_error(msg);
+        }
+
+        // Row groups without rows never contain start or stop - 1, only the ones between them are selected
+        uint32_t first = std::upper_bound(offsets.begin(), offsets.end(), start) - offsets.begin() - 1;
+        uint32_t last = std::lower_bound(offsets.begin(), offsets.end(), stop) - offsets.begin() - 1;
+
+        RowRangeSelection selection;
+        selection.row_groups.resize(last - first + 1);
+        std::iota(selection.row_groups.begin(), selection.row_groups.end(), first);
+        selection.first_row_group_offset = start - offsets[first];
+        selection.last_row_group_stop = stop - offsets[last];
+        return selection;
+    }
+
+    std::shared_ptr<::parquet::FileMetaData> ReadMetadata(const std::vector<uint32_t> &row_groups,
+                                                          const std::vector<uint32_t> &column_indices,
+                                                          const std::vector<std::string> &column_names,
+                                                          bool schema_only,
+                                                          bool project_arrow_schema,
+                                                          bool strip) const override
+    {
+        return ParseMetadata(ReadMetadataBytes(row_groups, column_indices, column_names, schema_only, project_arrow_schema, strip));
+    }
+
+    std::shared_ptr<arrow::Buffer> ReadMetadataBytes(const std::vector<uint32_t> &row_groups,
+                                                     const std::vector<uint32_t> &column_indices,
+                                                     const std::vector<std::string> &column_names,
+                                                     bool schema_only,
+                                                     bool project_arrow_schema,
+                                                     bool strip) const override
+    {
+        ValidateSelection(dataHeader, row_groups, column_indices, column_names);
+        return SpliceSelection(row_groups, GetColumns(column_indices, column_names), nullptr, schema_only, project_arrow_schema, strip);
+    }
+
+    std::shared_ptr<PreparedSelection> Prepare(const std::vector<uint32_t> &column_indices,
+                                               const std::vector<std::string> &column_names) const override
+    {
+        ValidateSelection(dataHeader, {}, column_indices, column_names);
+        auto selection = std::make_shared<PreparedSelectionImpl>();
+        selection->columns = GetColumns(column_indices, column_names);
+        selection->index_columns = dataHeader.columns;
+        selection->schema_length = GetSchemaLength(dataHeader, tables);
+        if (selection->columns.size() > 0)
+        {
+            ThriftCopyPlan plan;
+            SpliceSchema(plan, tables, selection->columns, GetSchemaTree());
+            auto schema = CopyMetadata(plan);
+            selection->schema.assign(schema->data(), schema->data() + schema->size());
+        }
+
+        return selection;
+    }
+
+    std::shared_ptr<::parquet::FileMetaData> ReadMetadata(const PreparedSelection &selection,
+                                                          const std::vector<uint32_t> &row_groups,
+                                                          bool schema_only,
+                                                          bool project_arrow_schema,
+                                                          bool strip) const override
+    {
+        return ParseMetadata(ReadMetadataBytes(selection, row_groups, schema_only, project_arrow_schema, strip));
+    }
+
+    std::shared_ptr<arrow::Buffer> ReadMetadataBytes(const PreparedSelection &selection,
+                                                     const std::vector<uint32_t> &row_groups,
+                                                     bool schema_only,
+                                                     bool project_arrow_schema,
+                                                     bool strip) const override
+    {
+        auto &prepared = static_cast<const PreparedSelectionImpl &>(selection);
+        if (prepared.index_columns != dataHeader.columns || prepared.schema_length != GetSchemaLength(dataHeader, tables))
+        {
+            auto msg = std::string("The prepared selection doesn't match the schema of the index!");
+            throw std::logic_error(msg);
+        }
+
+        ValidateSelection(dataHeader, row_groups, {}, {});
+        return SpliceSelection(row_groups, prepared.columns, &prepared.schema, schema_only, project_arrow_schema, strip);
+    }
+
+    bool has_row_group_statistics() const override
+    {
+        return FindExtensionSection(extension_sections, ExtensionSectionId::RowGroupStatistics) != nullptr;
+    }
+
+    std::vector<ColumnStatistics> ReadRowGroupStatistics(const std::vector<uint32_t> &column_indices,
+                                                         const std::vector<std::string> &column_names) const override
+    {
+        ValidateSelection(dataHeader, {}, column_indices, column_names);
+        const auto &row_group_statistics = GetRowGroupStatistics();
+        auto columns = GetColumns(column_indices, column_names);
+        if (columns.size() == 0)
+        {
+            columns.resize(dataHeader.columns);
+            std::iota(columns.begin(), columns.end(), 0);
+        }
+
+        auto bitmap_length = RowGroupStatistics::GetBitmapLength(dataHeader);
+        auto values_length = uint64_t(dataHeader.row_groups) * sizeof(uint64_t);
+        std::vector<ColumnStatistics> result(columns.size());
+        for (size_t idx = 0; idx < columns.size(); idx++)
+        {
+            auto &column_statistics = result[idx];
+            column_statistics.type = row_group_statistics.GetType(columns[idx]);
+            if (column_statistics.type == StatisticsType::None)
+                continue;
+
+            auto block = ReadIndexRange(statistics_section->offset + row_group_statistics.GetColumnOffset(columns[idx]), RowGroupStatistics::GetColumnLength(dataHeader));
+            column_statistics.has_min_max = arrow::SliceBuffer(block, 0, bitmap_length);
+            column_statistics.has_null_count = arrow::SliceBuffer(block, bitmap_length, bitmap_length);
+            column_statistics.min = arrow::SliceBuffer(block, 2 * bitmap_length, values_length);
+            column_statistics.max = arrow::SliceBuffer(block, 2 * bitmap_length + values_length, values_length);
+            column_statistics.null_count = arrow::SliceBuffer(block, 2 * bitmap_length + 2 * values_length, values_length);
+        }
+
+        return result;
+    }
+
+    std::vector<uint32_t> PruneRowGroups(const RowGroupFilter &filter) const override
+    {
+        GetRowGroupStatistics();
+        std::vector<std::string> column_names;
+        GetFilterColumns(filter, column_names);
+
+        RowGroupFilterEvaluator evaluator(dataHeader.row_groups, GetRowOffsets());
+        if (column_names.size() > 0)
+        {
+            // The Arrow types of the columns tell how the compared values are converted, e.g. the unit of a timestamp
+            auto statistics = ReadRowGroupStatistics({}, column_names);
+            if (statistics.size() != column_names.size())
+            {
+                auto msg = std::string("Filters can only compare leaf columns of a nested schema!");
+                throw std::logic_error(msg);
+            }
+
+            auto metadata = ReadMetadata({}, {}, column_names, true, false, false);
+            std::shared_ptr<arrow::Schema> schema;
+            PARQUET_THROW_NOT_OK(parquet::arrow::FromParquetSchema(metadata->schema(), &schema));
+            for (size_t i = 0; i < column_names.size(); i++)
+            {
+                auto field = schema->GetFieldByName(column_names[i]);
+                evaluator.AddColumn(column_names[i], std::move(statistics[i]), field != nullptr ? field->type() : nullptr);
+            }
+        }
+
+        auto keep = evaluator.Evaluate(filter);
+        std::vector<uint32_t> row_groups;
+        for (uint32_t row_group = 0; row_group < dataHeader.row_groups; row_group++)
+        {
+            if (keep[row_group])
+                row_groups.push_back(row_group);
+        }
+
+        return row_groups;
+    }
+
+    std::optional<uint32_t> sorted_key_column() const override
+    {
+        if (FindExtensionSection(extension_sections, ExtensionSectionId::SortedKey) == nullptr)
+            return std::nullopt;
+
+        return GetSortedKey().GetColumn();
+    }
+
+    std::vector<uint32_t> FindRowGroupsByKey(const std::shared_ptr<arrow::Scalar> &min,
+                                             const std::shared_ptr<arrow::Scalar> &max) const override
+    {
+        const auto &key = GetSortedKey();
+        if (min == nullptr && max == nullptr)
+        {
+            // Row groups without keys (only nulls) are left out like for any other range
+            return key.FindRowGroups(std::nullopt, std::nullopt);
+        }
+
+        // The bounds are converted like the values of a row group filter, e.g. to the unit of a timestamp column
+        auto metadata = ReadMetadata({}, {key.GetColumn()}, {}, true, false, false);
+        std::shared_ptr<arrow::Schema> schema;
+        PARQUET_THROW_NOT_OK(parquet::arrow::FromParquetSchema(metadata->schema(), &schema));
+        auto encode = [&](const std::shared_ptr<arrow::Scalar> &bound) -> std::optional<uint64_t>
+        {
+            if (bound == nullptr)
+                return std::nullopt;
+
+            auto encoded = schema->num_fields() == 1 ? EncodeFilterValue(key.GetType(), *schema->field(0)->type(), *bound) : std::nullopt;
+            if (!encoded)
+            {
+                auto msg = std::string("The key ") + bound->ToString() + " of type " + bound->type->ToString() + " can't be compared with the sorted key column '" + schema->field(0)->name() + "'!";
+                throw std::logic_error(msg);
+            }
+
+            return encoded;
+        };
+
+        return key.FindRowGroups(encode(min), encode(max));
+    }
+};
+
+// Serves an index that is completely in memory, either read from a file, memory mapped or supplied by the caller
+class BufferIndexReader : public IndexReaderBase
+{
+    std::shared_ptr<arrow::Buffer> index_buffer;
+
+    ColumnNamesSections LoadColumnNames() const override
+    {
+        auto hash_section = FindExtensionSection(extension_sections, ExtensionSectionId::ColumnNamesHash);
+        if (hash_section == nullptr)
+            return {tables.column_names, nullptr, 0};
+
+        return {tables.column_names, index_buffer->data() + hash_section->offset, hash_section->length};
+    }
+
+    ColumnChunksSelection LoadColumnChunks(const std::vector<uint32_t> &selected_row_groups, const std::vector<uint32_t> &columns) const override
+    {
+        auto column_chunks_table = packed_offsets ? index_buffer->data() + packed_offsets_section->offset : (const uint8_t *)tables.column_chunks_offsets;
+        return GatherColumnChunks(selected_row_groups, columns, [&](uint64_t offset, uint64_t)
+                                  { return column_chunks_table + offset; });
+    }
+
+    std::shared_ptr<arrow::Buffer> CopyMetadata(const ThriftCopyPlan &plan) const override
+    {
+        ThriftCopier thriftCopier(tables.metadata, dataHeader.metadata_length);
+        return thriftCopier.Copy(plan);
+    }
+
+    std::shared_ptr<arrow::Buffer> ReadIndexRange(uint64_t offset, uint64_t length) const override
+    {
+        return arrow::SliceBuffer(index_buffer, offset, length);
+    }
+
+public:
+    BufferIndexReader(const DataHeader &dataHeader, std::shared_ptr<arrow::Buffer> index_buffer, std::vector<ExtensionSection> extension_sections)
+        : IndexReaderBase(dataHeader, std::move(extension_sections)),
+          index_buffer(std::move(index_buffer))
+    {
+        tables = GetIndexTables(dataHeader, this->index_buffer->data() + dataHeader.get_header_size());
+        if (packed_offsets_section != nullptr)
+            packed_offsets.emplace(dataHeader, this->index_buffer->data() + packed_offsets_section->offset, packed_offsets_section->length);
+    }
+};
+
+// Keeps the offset tables that are O(row groups + columns) in memory and reads
+// the column chunk offsets of the selected row groups and the selected thrift ranges on demand
+class RangeIndexReader : public IndexReaderBase
+{
+    std::shared_ptr<arrow::io::RandomAccessFile> infile;
+    std::string index_file_path;
+    std::shared_ptr<arrow::Buffer> tables_buffer;
+    std::shared_ptr<arrow::Buffer> packed_offsets_buffer;
+    int64_t column_chunks_offset;
+    int64_t column_names_offset;
+    int64_t metadata_offset;
+    mutable std::unique_ptr<RangeBuffers> column_names_buffer;
+
+    ColumnNamesSections LoadColumnNames() const override
+    {
+        std::vector<arrow::io::ReadRange> ranges = {{column_names_offset, dataHeader.column_names_length}};
+        auto hash_section = FindExtensionSection(extension_sections, ExtensionSectionId::ColumnNamesHash);
+        if (hash_section != nullptr)
+            ranges.push_back({static_cast<int64_t>(hash_section->offset), static_cast<int64_t>(hash_section->length)});
+
+        column_names_buffer.reset(new RangeBuffers(infile.get(), index_file_path.c_str(), ranges));
+        auto column_names = column_names_buffer->GetData(column_names_offset, dataHeader.column_names_length);
+        if (hash_section == nullptr)
+            return {column_names, nullptr, 0};
+
+        return {column_names, column_names_buffer->GetData(hash_section->offset, hash_section->length), hash_section->length};
+    }
+
+    ColumnChunksSelection LoadColumnChunks(const std::vector<uint32_t> &selected_row_groups, const std::vector<uint32_t> &columns) const override
+    {
+        // Column chunk offsets of the selection (table rows, table columns or packed row group data), adjacent ones are read together
+        std::vector<arrow::io::ReadRange> table_ranges;
+        for (auto range : GetColumnChunksRanges(selected_row_groups, columns))
+        {
+            table_ranges.push_back({column_chunks_offset + static_cast<int64_t>(range.first), static_cast<int64_t>(range.second)});
+        }
+
+        RangeBuffers table_buffers(infile.get(), index_file_path.c_str(), table_ranges);
+        return GatherColumnChunks(selected_row_groups, columns, [&](uint64_t offset, uint64_t length)
+                                  { return table_buffers.GetData(column_chunks_offset + offset, length); });
+    }
+
+    std::shared_ptr<arrow::Buffer> CopyMetadata(const ThriftCopyPlan &plan) const override
+    {
+        auto plan_ranges = plan.GetRanges();
+        std::vector<arrow::io::ReadRange> metadata_ranges;
+        metadata_ranges.reserve(plan_ranges.size());
+        for (const auto &range : plan_ranges)
+        {
+            metadata_ranges.push_back({metadata_offset + range.offset, range.length});
+        }
+
+        RangeBuffers metadata_buffers(infile.get(), index_file_path.c_str(), metadata_ranges);
+        ThriftCopier thriftCopier(metadata_buffers.GetMetadataBlocks(metadata_offset), dataHeader.metadata_length);
+        return thriftCopier.Copy(plan);
+    }
+
+    std::shared_ptr<arrow::Buffer> ReadIndexRange(uint64_t offset, uint64_t length) const override
+    {
+        std::shared_ptr<arrow::Buffer> buffer;
+        PARQUET_ASSIGN_OR_THROW(buffer, infile->ReadAt(offset, length));
+        if (static_cast<uint64_t>(buffer->size()) != length)
+        {
+            auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+            throw std::logic_error(msg);
+        }
+
+        return buffer;
+    }
+
+public:
+    RangeIndexReader(const DataHeader &dataHeader, std::shared_ptr<arrow::io::RandomAccessFile> infile, const char *index_file_path, std::vector<ExtensionSection> extension_sections)
+        : IndexReaderBase(dataHeader, std::move(extension_sections)),
+          infile(std::move(infile)),
+          index_file_path(index_file_path)
+    {
+        // Everything before column_chunks_offsets is O(row groups + columns)
+        int64_t tables_offset = dataHeader.get_header_size();
+        int64_t tables_length = (dataHeader.get_num_rows_offsets_size() +
+                                 dataHeader.get_schema_offsets_size() +
+                                 dataHeader.get_schema_num_children_offsets_size() +
+                                 dataHeader.get_row_groups_offsets_size() +
+                                 dataHeader.get_column_orders_offsets_size()) *
+                                    sizeof(uint32_t) +
+                                dataHeader.get_row_numbers_size() * dataHeader.get_row_number_size();
+        column_chunks_offset = tables_offset + tables_length;
+        column_names_offset = column_chunks_offset + dataHeader.get_stored_column_chunks_offsets_size() * sizeof(uint32_t);
+        metadata_offset = column_names_offset + dataHeader.column_names_length;
+
+        PARQUET_ASSIGN_OR_THROW(tables_buffer, this->infile->ReadAt(tables_offset, tables_length));
+        if (tables_buffer->size() != tables_length)
+        {
+            auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+            throw std::logic_error(msg);
+        }
+
+        tables = GetIndexTables(dataHeader, tables_buffer->data());
+        tables.column_chunks_offsets = nullptr;
+        tables.column_names = nullptr;
+        tables.metadata = nullptr;
+
+        // Only the row group offsets of the packed section, the row group data is read on demand like the table rows
+        if (packed_offsets_section != nullptr)
+        {
+            auto row_group_offsets_length = PackedColumnChunksOffsets::GetRowGroupOffsetsLength(dataHeader);
+            PARQUET_ASSIGN_OR_THROW(packed_offsets_buffer, this->infile->ReadAt(packed_offsets_section->offset, row_group_offsets_length));
+            if (static_cast<uint64_t>(packed_offsets_buffer->size()) != row_group_offsets_length)
+            {
+                auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+                throw std::logic_error(msg);
+            }
+
+            column_chunks_offset = packed_offsets_section->offset;
+            packed_offsets.emplace(dataHeader, packed_offsets_buffer->data(), packed_offsets_section->length);
+        }
+    }
+};
+
+std::shared_ptr<IndexReader> IndexReader::Open(const char *index_file_path, IndexReadMode read_mode)
+{
+    std::shared_ptr<arrow::io::RandomAccessFile> infile;
+    if (read_mode == IndexReadMode::MemoryMap)
+    {
+        // Buffers read from a memory mapped file point straight into the page cache, so the body is never copied
+        PARQUET_ASSIGN_OR_THROW(infile, arrow::io::MemoryMappedFile::Open(std::string(index_file_path), arrow::io::FileMode::READ));
+    }
+    else
+    {
+        PARQUET_ASSIGN_OR_THROW(infile, arrow::io::ReadableFile::Open(std::string(index_file_path)));
+    }
+
+    DataHeader dataHeader;
+    {
+        uint8_t header[sizeof(DataHeaderV3)];
+        int64_t n;
+        PARQUET_ASSIGN_OR_THROW(n, infile->Read(sizeof(header), header));
+        if (n < HEADER_LENGTH)
+        {
+            auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+            throw std::logic_error(msg);
+        }
+
+        auto header_size = GetDataHeaderSize(header);
+        if (header_size == 0)
+        {
+            auto msg = std::string("File '") + index_file_path + "' has unexpected format!";
+            throw std::logic_error(msg);
+        }
+
+        if (static_cast<size_t>(n) < header_size)
+        {
+            auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+            throw std::logic_error(msg);
+        }
+
+        dataHeader = ParseDataHeader(header);
+    }
+
+    int64_t file_size;
+    PARQUET_ASSIGN_OR_THROW(file_size, infile->GetSize());
+    uint64_t index_length = dataHeader.get_index_size();
+    if (static_cast<uint64_t>(file_size) < index_length)
+    {
+        auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+        throw std::logic_error(msg);
+    }
+
+    if (read_mode == IndexReadMode::ReadRanges)
+    {
+        // Bytes after the body that are not extensions are ignored, as they always were
+        std::vector<ExtensionSection> extension_sections;
+        ReadExtensionSections(dataHeader, file_size, [&](uint64_t offset, uint64_t length)
+                              {
+                                  std::shared_ptr<arrow::Buffer> buffer;
+                                  PARQUET_ASSIGN_OR_THROW(buffer, infile->ReadAt(offset, length));
+                                  if (static_cast<uint64_t>(buffer->size()) != length)
+                                  {
+                                      auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+                                      throw std::logic_error(msg);
+                                  }
+                                  return buffer; }, extension_sections);
+
+        return std::make_shared<RangeIndexReader>(dataHeader, std::move(infile), index_file_path, std::move(extension_sections));
+    }
+
+    std::shared_ptr<arrow::Buffer> index_buffer;
+    PARQUET_ASSIGN_OR_THROW(index_buffer, infile->ReadAt(0, file_size));
+    if (index_buffer->size() != file_size)
+    {
+        auto msg = std::string("I/O error when reading '") + index_file_path + "'";
+        throw std::logic_error(msg);
+    }
+
+    std::vector<ExtensionSection> extension_sections;
+    ReadExtensionSections(dataHeader, index_buffer->size(), [&](uint64_t offset, uint64_t length)
+                          { return arrow::SliceBuffer(index_buffer, offset, length); }, extension_sections);
+
+    return std::make_shared<BufferIndexReader>(dataHeader, std::move(index_buffer), std::move(extension_sections));
+}
+
+std::shared_ptr<IndexReader> IndexReader::Open(std::shared_ptr<arrow::Buffer> index_data)
+{
+    uint64_t index_data_length = index_data->size();
+    if (index_data_length < sizeof(DataHeaderV2))
+    {
+        auto msg = std::string("Index data is too small, length=") + std::to_string(index_data_length);
+        throw std::logic_error(msg);
+    }
+
+    auto header_size = GetDataHeaderSize(index_data->data());
+    if (header_size == 0)
+    {
+        auto msg = std::string("Index file has unexpected format!");
+        throw std::logic_error(msg);
+    }
+
+    if (index_data_length < header_size)
+    {
+        auto msg = std::string("Index data is too small, length=") + std::to_string(index_data_length);
+        throw std::logic_error(msg);
+    }
+
+    auto dataHeader = ParseDataHeader(index_data->data());
+    uint64_t expected_length = dataHeader.get_index_size();
+    std::vector<ExtensionSection> extension_sections;
+    auto has_extensions = index_data_length > expected_length &&
+                          ReadExtensionSections(dataHeader, index_data_length, [&](uint64_t offset, uint64_t length)
+                                                { return arrow::SliceBuffer(index_data, offset, length); }, extension_sections);
+    if (index_data_length != expected_length && !has_extensions)
+    {
+        auto msg = std::string("Index data has unexpected length, length=") + std::to_string(index_data_length) + ", expected=" + std::to_string(expected_length);
+        throw std::logic_error(msg);
+    }
+
+    return std::make_shared<BufferIndexReader>(dataHeader, std::move(index_data), std::move(extension_sections));
+}
+
+/* Index pack layout:
+-----------------------------
+|       | 'PJP1'            | (char[4]) - Pack header in ASCI
+|       --------------------|
+|       | files             | (uint32) - Number of indexes in the pack
+|       --------------------|
+|       | keys length       | (uint64) - Length of the keys section
+|---------------------------|
+| . . . | fanout            | (uint32[256]) - Number of entries whose key hash has a top byte <= i
+|---------------------------|
+| . . . | entries           | (IndexPackEntry[files]) - Sorted by key hash, then by key
+|---------------------------|
+| . . . | keys              | [bytes] - The keys of the entries, without terminators
+|---------------------------|
+| . . . | indexes           | [bytes] - The index of every file (PJ_2 or PJ_3 with its extensions), each aligned to 8 bytes
+-----------------------------
+*/
+
+const int PACK_HEADER_LENGTH = 4;
+const char PACK_HEADER_V1[PACK_HEADER_LENGTH] = {'P', 'J', 'P', '1'};
+const uint32_t PACK_FANOUT_SIZE = 256;
+
+struct IndexPackHeader
+{
+    char header[PACK_HEADER_LENGTH] = {'P', 'J', 'P', '1'};
+    uint32_t files = 0;
+    uint64_t keys_length = 0;
+};
+
+struct IndexPackEntry
+{
+    uint64_t hash = 0;         // HashColumnName of the key
+    uint64_t index_offset = 0; // From the start of the pack
+    uint64_t index_length = 0;
+    uint32_t key_offset = 0; // From the start of the keys section
+    uint32_t key_length = 0;
+};
+
+inline uint32_t GetFanoutBucket(uint64_t hash) { return static_cast<uint32_t>(hash >> 56); }
+
+void IndexPackBuilder::Add(const std::string &key, std::shared_ptr<arrow::Buffer> index_data)
+{
+    IndexReader::Open(index_data);
+    indexes.emplace_back(key, std::move(index_data));
+}
+
+std::shared_ptr<arrow::Buffer> IndexPackBuilder::Finish() const
+{
+    std::vector<uint64_t> hashes(indexes.size());
+    std::vector<size_t> order(indexes.size());
+    for (size_t i = 0; i < indexes.size(); i++)
+        hashes[i] = HashColumnName(indexes[i].first.data(), indexes[i].first.length());
+
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+              { return std::tie(hashes[a], indexes[a].first) < std::tie(hashes[b], indexes[b].first); });
+
+    IndexPackHeader packHeader;
+    packHeader.files = indexes.size();
+    std::vector<uint32_t> fanout(PACK_FANOUT_SIZE);
+    std::vector<IndexPackEntry> entries(indexes.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        const auto &key = indexes[order[i]].first;
+        if (i > 0 && key == indexes[order[i - 1]].first)
+        {
+            auto msg = std::string("Index pack key '") + key + "' is added more than once!";
+            throw std::logic_error(msg);
+        }
+
+        if (packHeader.keys_length + key.length() > std::numeric_limits<uint32_t>::max())
+        {
+            auto msg = std::string("Index pack keys exceed 4 GiB!");
+            throw std::logic_error(msg);
+        }
+
+        entries[i].hash = TO_FILE_ENDIANESS(hashes[order[i]]);
+        entries[i].key_offset = TO_FILE_ENDIANESS(static_cast<uint32_t>(packHeader.keys_length));
+        entries[i].key_length = TO_FILE_ENDIANESS(static_cast<uint32_t>(key.length()));
+        entries[i].index_length = TO_FILE_ENDIANESS(static_cast<uint64_t>(indexes[order[i]].second->size()));
+        packHeader.keys_length += key.length();
+        fanout[GetFanoutBucket(hashes[order[i]])]++;
+    }
+
+    uint64_t index_offset = AlignExtensionOffset(sizeof(IndexPackHeader) + PACK_FANOUT_SIZE * sizeof(uint32_t) + entries.size() * sizeof(IndexPackEntry) + packHeader.keys_length);
+    for (auto &entry : entries)
+    {
+        entry.index_offset = TO_FILE_ENDIANESS(index_offset);
+        index_offset = AlignExtensionOffset(index_offset + FROM_FILE_ENDIANESS(entry.index_length));
+    }
+
+    for (uint32_t bucket = 1; bucket < PACK_FANOUT_SIZE; bucket++)
+        fanout[bucket] += fanout[bucket - 1];
+
+    for (auto &count : fanout)
+        count = TO_FILE_ENDIANESS(count);
+
+    std::shared_ptr<arrow::io::BufferOutputStream> fs;
+    PARQUET_ASSIGN_OR_THROW(fs, arrow::io::BufferOutputStream::Create(index_offset));
+    auto files = packHeader.files;
+    packHeader.files = TO_FILE_ENDIANESS(files);
+    packHeader.keys_length = TO_FILE_ENDIANESS(packHeader.keys_length);
+    PARQUET_THROW_NOT_OK(fs->Write(&packHeader, sizeof(packHeader)));
+    PARQUET_THROW_NOT_OK(fs->Write(fanout.data(), fanout.size() * sizeof(uint32_t)));
+    PARQUET_THROW_NOT_OK(fs->Write(entries.data(), entries.size() * sizeof(IndexPackEntry)));
+    for (auto i : order)
+        PARQUET_THROW_NOT_OK(fs->Write(indexes[i].first.data(), indexes[i].first.length()));
+
+    const uint8_t padding[8] = {};
+    for (auto i : order)
+    {
+        int64_t position;
+        PARQUET_ASSIGN_OR_THROW(position, fs->Tell());
+        PARQUET_THROW_NOT_OK(fs->Write(padding, AlignExtensionOffset(position) - position));
+        PARQUET_THROW_NOT_OK(fs->Write(indexes[i].second->data(), indexes[i].second->size()));
+    }
+
+    std::shared_ptr<arrow::Buffer> result;
+    PARQUET_ASSIGN_OR_THROW(result, fs->Finish());
+    return result;
+}
+
+void IndexPackBuilder::Finish(const char *pack_path) const
+{
+    auto buffer = Finish();
+    WriteIndexFile(pack_path, *buffer);
+}
+
+class IndexPackImpl : public IndexPack
+{
+    std::shared_ptr<arrow::Buffer> pack_buffer;
+    uint32_t files = 0;
+    std::vector<uint32_t> fanout;
+    std::vector<IndexPackEntry> entries; // In the file endianness converted to the native one
+    const char *keys_section = nullptr;
+    mutable std::mutex readers_mutex;
+    mutable std::vector<std::shared_ptr<IndexReader>> readers;
+
+    std::string_view GetKey(const IndexPackEntry &entry) const { return {keys_section + entry.key_offset, entry.key_length}; }
+
+    // The entry of the key, the number of files if the pack doesn't have it
+    uint32_t Find(const std::string &key) const
+    {
+        auto hash = HashColumnName(key.data(), key.length());
+        auto bucket = GetFanoutBucket(hash);
+        auto begin = entries.begin() + (bucket == 0 ? 0 : fanout[bucket - 1]);
+        auto end = entries.begin() + fanout[bucket];
+        auto entry = std::lower_bound(begin, end, hash, [](const IndexPackEntry &entry, uint64_t hash)
+                                      { return entry.hash < hash; });
+        for (; entry != end && entry->hash == hash; entry++)
+        {
+            if (GetKey(*entry) == key)
+                return entry - entries.begin();
+        }
+
+        return files;
+    }
+
+public:
+    explicit IndexPackImpl(std::shared_ptr<arrow::Buffer> pack_data) : pack_buffer(std::move(pack_data))
+    {
+        uint64_t pack_length = pack_buffer->size();
+        IndexPackHeader packHeader;
+        if (pack_length < sizeof(packHeader))
+        {
+            auto msg = std::string("Index pack is too small, length=") + std::to_string(pack_length);
+            throw std::logic_error(msg);
+        }
+
+        memcpy(&packHeader, pack_buffer->data(), sizeof(packHeader));
+        if (memcmp(PACK_HEADER_V1, packHeader.header, PACK_HEADER_LENGTH) != 0)
+        {
+            auto msg = std::string("Index pack has unexpected format!");
+            throw std::logic_error(msg);
+        }
+
+        files = FROM_FILE_ENDIANESS(packHeader.files);
+        uint64_t keys_length = FROM_FILE_ENDIANESS(packHeader.keys_length);
+        uint64_t entries_offset = sizeof(packHeader) + PACK_FANOUT_SIZE * sizeof(uint32_t);
+        uint64_t keys_offset = entries_offset + uint64_t(files) * sizeof(IndexPackEntry);
+        if (pack_length < keys_offset || pack_length - keys_offset < keys_length)
+        {
+            auto msg = std::string("Index pack is too small, length=") + std::to_string(pack_length);
+            throw std::logic_error(msg);
+        }
+
+        fanout.resize(PACK_FANOUT_SIZE);
+        memcpy(fanout.data(), pack_buffer->data() + sizeof(packHeader), PACK_FANOUT_SIZE * sizeof(uint32_t));
+        entries.resize(files);
+        memcpy(entries.data(), pack_buffer->data() + entries_offset, entries.size() * sizeof(IndexPackEntry));
+        keys_section = (const char *)pack_buffer->data() + keys_offset;
+
+        // Lookups trust the directory, so it is validated once here
+        uint32_t previous_count = 0;
+        for (auto &count : fanout)
+        {
+            count = FROM_FILE_ENDIANESS(count);
+            if (count < previous_count || count > files)
+            {
+                auto msg = std::string("Index pack directory is invalid!");
+                throw std::logic_error(msg);
+            }
+
+            previous_count = count;
+        }
+
+        for (uint32_t i = 0; i < files; i++)
+        {
+            auto &entry = entries[i];
+            entry.hash = FROM_FILE_ENDIANESS(entry.hash);
+            entry.index_offset = FROM_FILE_ENDIANESS(entry.index_offset);
+            entry.index_length = FROM_FILE_ENDIANESS(entry.index_length);
+            entry.key_offset = FROM_FILE_ENDIANESS(entry.key_offset);
+            entry.key_length = FROM_FILE_ENDIANESS(entry.key_length);
+            auto bucket = GetFanoutBucket(entry.hash);
+            if (previous_count != files ||
+                i < (bucket == 0 ? 0 : fanout[bucket - 1]) || i >= fanout[bucket] ||
+                (i > 0 && entry.hash < entries[i - 1].hash) ||
+                entry.key_offset > keys_length || entry.key_length > keys_length - entry.key_offset ||
+                entry.index_offset > pack_length || entry.index_length > pack_length - entry.index_offset ||
+                HashColumnName(keys_section + entry.key_offset, entry.key_length) != entry.hash)
+            {
+                auto msg = std::string("Index pack directory is invalid!");
+                throw std::logic_error(msg);
+            }
+        }
+
+        readers.resize(files);
+    }
+
+    uint32_t num_files() const override { return files; }
+
+    std::vector<std::string> keys() const override
+    {
+        std::vector<std::string> result;
+        result.reserve(files);
+        for (const auto &entry : entries)
+            result.emplace_back(GetKey(entry));
+
+        return result;
+    }
+
+    bool Contains(const std::string &key) const override { return Find(key) < files; }
+
+    std::shared_ptr<IndexReader> GetReader(const std::string &key) const override
+    {
+        auto i = Find(key);
+        if (i == files)
+        {
+            auto msg = std::string("Index pack has no index for the key '") + key + "'!";
+            throw std::logic_error(msg);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(readers_mutex);
+            if (readers[i])
+                return readers[i];
+        }
+
+        // Opening validates the index, a reader opened twice by racing threads is as good as the other
+        auto reader = IndexReader::Open(arrow::SliceBuffer(pack_buffer, entries[i].index_offset, entries[i].index_length));
+        std::lock_guard<std::mutex> lock(readers_mutex);
+        if (!readers[i])
+            readers[i] = std::move(reader);
+
+        return readers[i];
+    }
+};
+
+std::shared_ptr<IndexPack> IndexPack::Open(const char *pack_path)
+{
+    std::shared_ptr<arrow::io::MemoryMappedFile> infile;
+    PARQUET_ASSIGN_OR_THROW(infile, arrow::io::MemoryMappedFile::Open(std::string(pack_path), arrow::io::FileMode::READ));
+    int64_t file_size;
+    PARQUET_ASSIGN_OR_THROW(file_size, infile->GetSize());
+    std::shared_ptr<arrow::Buffer> pack_buffer;
+    PARQUET_ASSIGN_OR_THROW(pack_buffer, infile->ReadAt(0, file_size));
+    if (pack_buffer->size() != file_size)
+    {
+        auto msg = std::string("I/O error when reading '") + pack_path + "'";
+        throw std::logic_error(msg);
+    }
+
+    return std::make_shared<IndexPackImpl>(std::move(pack_buffer));
+}
+
+std::shared_ptr<IndexPack> IndexPack::Open(std::shared_ptr<arrow::Buffer> pack_data)
+{
+    return std::make_shared<IndexPackImpl>(std::move(pack_data));
+}
+
+} // namespace palletjack
+
+std::shared_ptr<parquet::FileMetaData> ReadMetadata(const char *index_file_path,
+                                                    const std::vector<uint32_t> &row_groups,
+                                                    const std::vector<uint32_t> &column_indices,
+                                                    const std::vector<std::string> &column_names,
+                                                    bool schema_only,
+                                                    IndexReadMode read_mode)
+{
+    auto reader = palletjack::IndexReader::Open(index_file_path, read_mode);
+    return reader->ReadMetadata(row_groups, column_indices, column_names, schema_only);
+}
+
+std::shared_ptr<parquet::FileMetaData> ReadMetadata(const unsigned char *index_data,
+                                                    size_t index_data_length,
+                                                    const std::vector<uint32_t> &row_groups,
+                                                    const std::vector<uint32_t> &column_indices,
+                                                    const std::vector<std::string> &column_names,
+                                                    bool schema_only)
+{
+    // The buffer doesn't own the data, it is only used for the duration of the call
+    auto reader = palletjack::IndexReader::Open(std::make_shared<arrow::Buffer>(index_data, index_data_length));
+    return reader->ReadMetadata(row_groups, column_indices, column_names, schema_only);
+}
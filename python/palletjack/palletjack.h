@@ -1,15 +1,53 @@
 #include "arrow/buffer.h"
+#include "arrow/scalar.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/arrow/schema.h"
 
-std::shared_ptr<arrow::Buffer> GenerateMetadataIndex(const char *parquet_path);
-void GenerateMetadataIndex(const char *parquet_path, const char *index_file_path);
+enum class IndexReadMode
+{
+    ReadAll,    // Reads the whole index body with a single read
+    ReadRanges, // Reads the offset tables first, then only the thrift ranges needed by the selection
+    MemoryMap,  // Memory maps the index file, the metadata is copied straight from the page cache
+};
+
+struct GenerateMetadataIndexOptions
+{
+    // Stores a hash table of the column names, so selecting columns by name doesn't need to read and hash all the names
+    bool column_names_hash = false;
+    // 2 (PJ_2) or 3 (PJ_3, 64-bit row counts and index sizes), 0 picks 2 unless the index needs 3
+    uint32_t format_version = 0;
+    // Stores the column chunk offsets bit-packed, which makes them several times smaller. Needs format version 3.
+    bool packed_offsets = false;
+    // Stores the column chunk offsets column-major, so reading a few columns over many row groups touches contiguous memory.
+    // Needs format version 3, can't be combined with packed_offsets.
+    bool column_major_offsets = false;
+    // Stores the min, max and null count of every column chunk column by column, so row groups can be pruned
+    // without parsing any thrift
+    bool row_group_statistics = false;
+    // Stores the min and max of the first sorting column (declared by the row groups' sorting_columns) of every row group,
+    // so the row groups of a key range are found by a binary search. Fails if the row groups aren't sorted by it.
+    bool sorted_key_index = false;
+    // Stores where the statistics, encoding_stats, bloom filter and size_statistics fields of every column chunk are,
+    // so reads with strip leave them out
+    bool strip_ranges = false;
+};
+
+std::shared_ptr<arrow::Buffer> GenerateMetadataIndex(const char *parquet_path, const GenerateMetadataIndexOptions &options = {});
+void GenerateMetadataIndex(const char *parquet_path, const char *index_file_path, const GenerateMetadataIndexOptions &options = {});
+// Generates an index file for every (parquet path, index file path) pair on num_threads threads (0 = one per core).
+// memory_limit caps the estimated memory of the indexes generated at the same time.
+// Returns an error message for every pair, empty if the index was written.
+std::vector<std::string> GenerateMetadataIndexes(const std::vector<std::pair<std::string, std::string>> &parquet_and_index_file_paths,
+                                                 uint32_t num_threads = 0,
+                                                 int64_t memory_limit = 1LL << 30,
+                                                 const GenerateMetadataIndexOptions &options = {});
 std::shared_ptr<parquet::FileMetaData> ReadMetadata(const char *index_file_path,
                                                     const std::vector<uint32_t> &row_groups,
                                                     const std::vector<uint32_t> &column_indices,
                                                     const std::vector<std::string> &column_names,
-                                                    bool schema_only = false);
+                                                    bool schema_only = false,
+                                                    IndexReadMode read_mode = IndexReadMode::ReadAll);
 
 std::shared_ptr<parquet::FileMetaData> ReadMetadata(const unsigned char *index_data,
                                                     size_t index_data_length,
@@ -17,3 +55,186 @@ std::shared_ptr<parquet::FileMetaData> ReadMetadata(const unsigned char *index_d
                                                     const std::vector<uint32_t> &column_indices,
                                                     const std::vector<std::string> &column_names,
                                                     bool schema_only = false);
+
+namespace arrow::compute
+{
+class Expression;
+}
+
+namespace palletjack
+{
+
+// The row groups covering a range of rows of the file
+struct RowRangeSelection
+{
+    std::vector<uint32_t> row_groups;
+    int64_t first_row_group_offset = 0; // Rows to skip at the start of the first row group
+    int64_t last_row_group_stop = 0;    // Rows to read from the last row group, counted from its start
+};
+
+// How the min and max values of a column are stored in the row group statistics
+enum class StatisticsType : uint8_t
+{
+    None = 0,        // No statistics, the column's type has no usable order or no row group has statistics
+    Int64 = 1,       // Booleans and signed integers, including dates, times, timestamps and unscaled decimals
+    UInt64 = 2,      // Unsigned integers
+    Double = 3,      // Floats and doubles, statistics with NaN are left out
+    BytesPrefix = 4, // Strings and binaries, the first 8 bytes zero-padded and read as a big-endian uint64.
+                     // The prefixes keep the order of the values, but different values can have the same prefix.
+};
+
+// The statistics of one column over all row groups of the index, the buffers are laid out like Arrow arrays
+struct ColumnStatistics
+{
+    StatisticsType type = StatisticsType::None;
+    std::shared_ptr<arrow::Buffer> has_min_max;    // Bitmap of the row groups that have min and max (LSB first)
+    std::shared_ptr<arrow::Buffer> has_null_count; // Bitmap of the row groups that have a null count
+    std::shared_ptr<arrow::Buffer> min;            // rg values of 8 bytes, int64, uint64 or double by type
+    std::shared_ptr<arrow::Buffer> max;            // rg values of 8 bytes
+    std::shared_ptr<arrow::Buffer> null_count;     // rg int64 values
+};
+
+// A predicate over the row group statistics. A row group is pruned when its statistics prove that no row satisfies it,
+// the parts the statistics can't decide (Any) keep every row group.
+struct RowGroupFilter
+{
+    enum class Kind : uint8_t
+    {
+        Any,          // Keeps every row group
+        And,          // All children
+        Or,           // Any of the children
+        Equal,        // column == value
+        NotEqual,     // column != value
+        Less,         // column < value
+        LessEqual,    // column <= value
+        Greater,      // column > value
+        GreaterEqual, // column >= value
+        IsNull,       // column is null
+        IsValid,      // column is not null
+    };
+
+    Kind kind = Kind::Any;
+    std::string column;                   // Name of the column of comparisons and null tests
+    std::shared_ptr<arrow::Scalar> value; // Compared value, converted to the type of the column when evaluated (e.g. a timestamp unit)
+    std::vector<RowGroupFilter> children; // And, Or
+
+    // Converts the comparisons (a field on one side, a literal on the other), and, or, invert, is_in, is_null and is_valid
+    // of an expression, anything else becomes Any
+    static RowGroupFilter FromExpression(const arrow::compute::Expression &expression);
+};
+
+// A column selection resolved once against an index, for reading any number of row group selections
+// from that index or from any other index of a file with the same schema.
+// Holds the spliced schema list, so reads with it only splice the row groups. Immutable, so it can be shared between threads.
+class PreparedSelection
+{
+public:
+    virtual ~PreparedSelection() = default;
+
+    virtual const std::vector<uint32_t> &column_indices() const = 0;
+};
+
+// A handle to an index, which reads and validates the index header once and then serves any number of ReadMetadata calls.
+// All methods are thread-safe, so a single handle can be shared between threads.
+class IndexReader
+{
+public:
+    virtual ~IndexReader() = default;
+
+    static std::shared_ptr<IndexReader> Open(const char *index_file_path, IndexReadMode read_mode = IndexReadMode::ReadAll);
+    // The reader keeps a reference to index_data, nothing is copied
+    static std::shared_ptr<IndexReader> Open(std::shared_ptr<arrow::Buffer> index_data);
+
+    virtual uint32_t num_row_groups() const = 0;
+    virtual uint32_t num_columns() const = 0;
+    virtual int64_t num_rows() const = 0;
+
+    // The row groups covering the rows [start, stop), found by a binary search over the prefix sums of the row counts
+    virtual RowRangeSelection FindRowGroups(int64_t start, int64_t stop) const = 0;
+
+    // project_arrow_schema rewrites the ARROW:schema of the key_value_metadata (written by Arrow for every column)
+    // to the selected columns, so it isn't copied and decoded whole. It is copied as it is when no columns are selected.
+    // strip leaves the statistics, encoding_stats, bloom filter and size_statistics fields out of the column chunks,
+    // which data reads don't need. Needs an index generated with strip_ranges.
+    virtual std::shared_ptr<::parquet::FileMetaData> ReadMetadata(const std::vector<uint32_t> &row_groups,
+                                                                  const std::vector<uint32_t> &column_indices,
+                                                                  const std::vector<std::string> &column_names,
+                                                                  bool schema_only = false,
+                                                                  bool project_arrow_schema = false,
+                                                                  bool strip = false) const = 0;
+
+    // Empty column_indices and column_names select all columns
+    virtual std::shared_ptr<PreparedSelection> Prepare(const std::vector<uint32_t> &column_indices,
+                                                       const std::vector<std::string> &column_names) const = 0;
+    // The index must have the same schema as the index the selection was prepared with
+    virtual std::shared_ptr<::parquet::FileMetaData> ReadMetadata(const PreparedSelection &selection,
+                                                                  const std::vector<uint32_t> &row_groups,
+                                                                  bool schema_only = false,
+                                                                  bool project_arrow_schema = false,
+                                                                  bool strip = false) const = 0;
+
+    // The spliced thrift FileMetaData that ReadMetadata parses, for consumers that don't need a parquet::FileMetaData
+    virtual std::shared_ptr<arrow::Buffer> ReadMetadataBytes(const std::vector<uint32_t> &row_groups,
+                                                             const std::vector<uint32_t> &column_indices,
+                                                             const std::vector<std::string> &column_names,
+                                                             bool schema_only = false,
+                                                             bool project_arrow_schema = false,
+                                                             bool strip = false) const = 0;
+    virtual std::shared_ptr<arrow::Buffer> ReadMetadataBytes(const PreparedSelection &selection,
+                                                             const std::vector<uint32_t> &row_groups,
+                                                             bool schema_only = false,
+                                                             bool project_arrow_schema = false,
+                                                             bool strip = false) const = 0;
+
+    // False if the index was generated without row_group_statistics
+    virtual bool has_row_group_statistics() const = 0;
+    // Empty column_indices and column_names select all columns. Buffers of types other than None are never null.
+    virtual std::vector<ColumnStatistics> ReadRowGroupStatistics(const std::vector<uint32_t> &column_indices,
+                                                                 const std::vector<std::string> &column_names) const = 0;
+    // The row groups whose statistics don't rule out the filter, in order. Needs row_group_statistics.
+    virtual std::vector<uint32_t> PruneRowGroups(const RowGroupFilter &filter) const = 0;
+
+    // The sorted key column, nullopt if the index was generated without sorted_key_index
+    virtual std::optional<uint32_t> sorted_key_column() const = 0;
+    // The row groups that may have keys in [min, max], found by a binary search over the sorted key section.
+    // A null min or max leaves that end of the range open. Needs sorted_key_index.
+    virtual std::vector<uint32_t> FindRowGroupsByKey(const std::shared_ptr<arrow::Scalar> &min,
+                                                     const std::shared_ptr<arrow::Scalar> &max) const = 0;
+};
+
+// Collects the indexes of many files and writes them into a single index pack, keyed by file (e.g. the parquet path)
+class IndexPackBuilder
+{
+    std::vector<std::pair<std::string, std::shared_ptr<arrow::Buffer>>> indexes;
+
+public:
+    // Checks that index_data is an index (PJ_2 or PJ_3), the builder keeps a reference to it until Finish.
+    // Fails on Finish if a key is added twice.
+    void Add(const std::string &key, std::shared_ptr<arrow::Buffer> index_data);
+    size_t size() const { return indexes.size(); }
+
+    std::shared_ptr<arrow::Buffer> Finish() const;
+    void Finish(const char *pack_path) const;
+};
+
+// A handle to an index pack, which reads and validates the key directory once and then serves the index of any file.
+// The indexes are read in place from the pack, nothing is copied. All methods are thread-safe.
+class IndexPack
+{
+public:
+    virtual ~IndexPack() = default;
+
+    // Memory maps the pack, so opening it costs a single open however many files it has
+    static std::shared_ptr<IndexPack> Open(const char *pack_path);
+    // The pack keeps a reference to pack_data, nothing is copied
+    static std::shared_ptr<IndexPack> Open(std::shared_ptr<arrow::Buffer> pack_data);
+
+    virtual uint32_t num_files() const = 0;
+    // The keys in the order of the pack, which is the order of their hashes
+    virtual std::vector<std::string> keys() const = 0;
+    virtual bool Contains(const std::string &key) const = 0;
+    // The reader of the index of the file, opened on the first call for the key and shared by the later ones
+    virtual std::shared_ptr<IndexReader> GetReader(const std::string &key) const = 0;
+};
+
+} // namespace palletjack
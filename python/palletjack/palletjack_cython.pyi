@@ -1,24 +1,84 @@
-from typing import Optional, Sequence, overload
+import mmap
+from typing import Any, List, Optional, Sequence, Tuple, Union, overload
 
 import pyarrow as pa
+import pyarrow.compute as pc
+import pyarrow.dataset as ds
+import pyarrow.fs
 import pyarrow.parquet as pq
 
+# In-memory index data, any object supporting the buffer protocol is read without copying
+_IndexData = Union[bytes, bytearray, memoryview, mmap.mmap, pa.Buffer]
+
+# A filter expression, or filters in the disjunctive normal form of pyarrow.parquet.read_table
+_Filter = Union[pc.Expression, List[Tuple], List[List[Tuple]]]
+
 @overload
 def generate_metadata_index(
     parquet_path: str,
     index_file_path: str,
+    column_names_hash: bool = False,
+    format_version: int = 0,
+    packed_offsets: bool = False,
+    column_major_offsets: bool = False,
+    row_group_statistics: bool = False,
+    sorted_key_index: bool = False,
+    strip_ranges: bool = False,
 ) -> None: ...
 @overload
 def generate_metadata_index(
     parquet_path: str,
-) -> bytearray:
+    *,
+    column_names_hash: bool = False,
+    format_version: int = 0,
+    packed_offsets: bool = False,
+    column_major_offsets: bool = False,
+    row_group_statistics: bool = False,
+    sorted_key_index: bool = False,
+    strip_ranges: bool = False,
+) -> pa.Buffer:
     """Generate a metadata index for a Parquet file.
 
     Args:
         parquet_path: Path to the source Parquet file.
         index_file_path: If provided, the index is written to this path and
             ``None`` is returned.  If omitted, the index is returned as a
-            ``bytearray``.
+            :class:`pyarrow.Buffer` owning the generated index, nothing is
+            copied.
+        column_names_hash: Also store a hash table of the column names, so
+            selecting columns by name costs O(selected columns) instead of
+            reading every column name.  Indexes with the table can't be read
+            from memory by older PalletJack versions.
+        format_version: ``2`` writes a ``PJ_2`` index, ``3`` a ``PJ_3`` index
+            with 64-bit row counts, which older PalletJack versions can't
+            read.  ``0`` writes ``PJ_2`` unless the file has a row group with
+            more than 2**32 - 1 rows, a nested schema (structs, lists or maps)
+            or the index exceeds 4 GiB.
+        packed_offsets: Store the column chunk offsets bit-packed instead of as
+            a ``uint32`` per column and row group, which makes them several
+            times smaller.  Only the offsets of the selected row groups and
+            columns are decoded.  Needs ``format_version`` ``0`` or ``3``.
+        column_major_offsets: Store the column chunk offsets column-major, so
+            reading a few columns over many row groups gathers them from
+            contiguous memory (and with ``read_mode='ranges'`` reads only
+            those columns of the table).  Needs ``format_version`` ``0`` or
+            ``3``, can't be combined with *packed_offsets*.
+        row_group_statistics: Also store the min, max and null count of
+            every column chunk column by column, see
+            :meth:`IndexReader.read_row_group_statistics`.  Only the
+            Thrift statistics written with a type-defined column order are
+            stored.
+        sorted_key_index: Also store the min and max of the sort key of every
+            row group as dense arrays, so the row groups of a key range are
+            found by a binary search, see
+            :meth:`IndexReader.find_row_groups_by_key`.  The key is the first
+            of the ``sorting_columns`` declared by the row groups (e.g.
+            written with ``pq.write_table(..., sorting_columns=...)``).
+            Fails if the row groups don't all declare it, or aren't sorted by
+            it.
+        strip_ranges: Also store where the statistics, ``encoding_stats``,
+            bloom filter and ``size_statistics`` fields of every column chunk
+            are, so reads with ``strip=True`` leave them out.
 
     Returns:
         The serialized index when *index_file_path* is ``None``, otherwise
@@ -26,12 +86,112 @@ def generate_metadata_index(
     """
     ...
 
+def generate_metadata_indexes(
+    parquet_and_index_file_paths: Sequence[Tuple[str, str]],
+    num_threads: int = 0,
+    memory_limit: int = 1 << 30,
+    column_names_hash: bool = False,
+    format_version: int = 0,
+    packed_offsets: bool = False,
+    column_major_offsets: bool = False,
+    row_group_statistics: bool = False,
+    sorted_key_index: bool = False,
+    strip_ranges: bool = False,
+) -> List[Optional[str]]:
+    """Generate metadata index files for many Parquet files in parallel.
+
+    A failing file doesn't stop the others, its error is returned instead.
+
+    Args:
+        parquet_and_index_file_paths: ``(parquet_path, index_file_path)``
+            pairs, each index is written to its *index_file_path*.
+        num_threads: Number of threads, ``0`` uses one thread per core.
+        memory_limit: Caps the estimated memory (in bytes) of the indexes
+            generated at the same time.  A file whose index alone exceeds the
+            cap is still indexed, just not alongside other files.
+        column_names_hash: See :func:`generate_metadata_index`.
+        format_version: See :func:`generate_metadata_index`.
+        packed_offsets: See :func:`generate_metadata_index`.
+        column_major_offsets: See :func:`generate_metadata_index`.
+        row_group_statistics: See :func:`generate_metadata_index`.
+        sorted_key_index: See :func:`generate_metadata_index`.
+        strip_ranges: See :func:`generate_metadata_index`.
+
+    Returns:
+        One entry per pair, ``None`` if the index was written, otherwise the
+        error message.
+    """
+    ...
+
+@overload
+def generate_index_pack(
+    parquet_paths: Sequence[str],
+    pack_path: None = None,
+    keys: Optional[Sequence[str]] = None,
+    num_threads: int = 0,
+    column_names_hash: bool = False,
+    format_version: int = 0,
+    packed_offsets: bool = False,
+    column_major_offsets: bool = False,
+    row_group_statistics: bool = False,
+    sorted_key_index: bool = False,
+    strip_ranges: bool = False,
+) -> pa.Buffer: ...
+@overload
+def generate_index_pack(
+    parquet_paths: Sequence[str],
+    pack_path: str,
+    keys: Optional[Sequence[str]] = None,
+    num_threads: int = 0,
+    column_names_hash: bool = False,
+    format_version: int = 0,
+    packed_offsets: bool = False,
+    column_major_offsets: bool = False,
+    row_group_statistics: bool = False,
+    sorted_key_index: bool = False,
+    strip_ranges: bool = False,
+) -> None:
+    """Generate the indexes of many Parquet files into a single index pack.
+
+    A pack replaces an index file per Parquet file with one file, which is
+    opened and memory mapped once by :class:`IndexPack`.  The indexes are
+    generated in parallel and kept in memory until the pack is written.
+
+    Args:
+        parquet_paths: Paths of the Parquet files.
+        pack_path: Path of the pack file to write.  ``None`` returns the pack
+            as a :class:`pyarrow.Buffer` instead.
+        keys: The key of every file in the pack, ``None`` uses
+            *parquet_paths*.
+        num_threads: Number of threads, ``0`` uses one thread per core.
+        column_names_hash: See :func:`generate_metadata_index`.
+        format_version: See :func:`generate_metadata_index`.
+        packed_offsets: See :func:`generate_metadata_index`.
+        column_major_offsets: See :func:`generate_metadata_index`.
+        row_group_statistics: See :func:`generate_metadata_index`.
+        sorted_key_index: See :func:`generate_metadata_index`.
+        strip_ranges: See :func:`generate_metadata_index`.
+
+    Returns:
+        The serialized pack when *pack_path* is ``None``, otherwise ``None``.
+
+    Raises:
+        RuntimeError: If a file can't be indexed or a key is repeated.
+    """
+    ...
+
 def read_metadata(
     index_file_path: Optional[str] = None,
     row_groups: Sequence[int] = [],
     column_indices: Sequence[int] = [],
     column_names: Sequence[str] = [],
-    index_data: Optional[bytes] = None,
+    index_data: Optional[_IndexData] = None,
+    read_mode: str = 'full',
+    prepared: Optional[PreparedSelection] = None,
+    row_range: Optional[Tuple[int, int]] = None,
+    key_range: Optional[Tuple[Any, Any]] = None,
+    project_arrow_schema: bool = False,
+    strip: bool = False,
 ) -> pq.FileMetaData:
     """Read Parquet metadata from a previously generated index.
 
@@ -41,10 +201,44 @@ def read_metadata(
     Args:
         index_file_path: Path to the index file on disk.
         row_groups: Subset of row-group indices to read.
-        column_indices: Subset of column indices to read.
-        column_names: Subset of column names to read.
-        index_data: In-memory index bytes (e.g. from
-            :func:`generate_metadata_index`).
+        column_indices: Subset of column indices to read.  The indices of a
+            nested schema are its leaf columns.
+        column_names: Subset of column names to read.  The names of a nested
+            schema are the dotted paths of its elements, e.g. ``'s.y.p'``; a
+            top-level field or group name selects all of its leaf columns.
+            The leaves of a group are kept together, in the order the groups
+            first appear.  A leaf of a map also selects the map's key.
+        index_data: In-memory index data, e.g. from
+            :func:`generate_metadata_index`, a :class:`pyarrow.Buffer` or an
+            :class:`mmap.mmap`.  It is read in place, not copied.
+        read_mode: How *index_file_path* is read.  ``'full'`` reads the whole
+            index with a single read, ``'ranges'`` reads the offset tables
+            first and then only the metadata ranges needed by the selection,
+            which is faster on network filesystems.  ``'mmap'`` memory maps
+            the index, so the metadata is copied straight from the page cache
+            and processes share one copy of it.  ``'full'`` is the default
+            here, for :class:`IndexReader` and for :func:`dataset` alike.
+            Ignored for *index_data*.
+        prepared: A column selection from :func:`prepare`, used instead of
+            *column_indices* and *column_names*.
+        row_range: ``(start, stop)`` rows of the file, used instead of
+            *row_groups* to select the row groups covering them, see
+            :meth:`IndexReader.find_row_groups`.
+        key_range: ``(min, max)`` sort keys, used instead of *row_groups* to
+            select the row groups that may have keys in them, see
+            :meth:`IndexReader.find_row_groups_by_key`.  Selects no row
+            groups if none match.
+        project_arrow_schema: Rewrite the ``ARROW:schema`` key-value
+            metadata, which Arrow writes for every column of the file, to
+            the selected columns.  Keeps the Arrow types that aren't stored
+            in the Parquet schema (e.g. ``timestamp[s]``, ``large_string``)
+            without copying and decoding the schema of every column on each
+            read.  The full schema is decoded once per :class:`IndexReader`.
+        strip: Leave the statistics, ``encoding_stats``, bloom filter and
+            ``size_statistics`` fields out of every column chunk.  Reading
+            the data doesn't need them, and on columns with long min and max
+            values they are most of the metadata.  Needs an index generated
+            with ``strip_ranges``.
 
     Returns:
         A :class:`pyarrow.parquet.FileMetaData` instance containing only the
@@ -52,11 +246,41 @@ def read_metadata(
     """
     ...
 
+def read_metadata_bytes(
+    index_file_path: Optional[str] = None,
+    row_groups: Sequence[int] = [],
+    column_indices: Sequence[int] = [],
+    column_names: Sequence[str] = [],
+    index_data: Optional[_IndexData] = None,
+    read_mode: str = 'full',
+    prepared: Optional[PreparedSelection] = None,
+    row_range: Optional[Tuple[int, int]] = None,
+    key_range: Optional[Tuple[Any, Any]] = None,
+    project_arrow_schema: bool = False,
+    strip: bool = False,
+) -> pa.Buffer:
+    """Read the Thrift-encoded Parquet metadata from a previously generated index.
+
+    Returns the bytes :func:`read_metadata` would parse, in the format of a
+    Parquet footer, without parsing them.  Useful for consumers that don't
+    need a :class:`pyarrow.parquet.FileMetaData`, e.g. non-Arrow readers or
+    forwarding the metadata to another process.
+
+    See :func:`read_metadata` for the arguments.
+
+    Returns:
+        A :class:`pyarrow.Buffer` owning the metadata, nothing is copied.
+    """
+    ...
+
 def read_schema(
     index_file_path: Optional[str] = None,
     column_indices: Sequence[int] = [],
     column_names: Sequence[str] = [],
-    index_data: Optional[bytes] = None,
+    index_data: Optional[_IndexData] = None,
+    read_mode: str = 'full',
+    prepared: Optional[PreparedSelection] = None,
+    project_arrow_schema: bool = False,
 ) -> pa.Schema:
     """Read the Arrow schema from a previously generated index.
 
@@ -69,10 +293,418 @@ def read_schema(
         index_file_path: Path to the index file on disk.
         column_indices: Subset of column indices to read.
         column_names: Subset of column names to read.
-        index_data: In-memory index bytes (e.g. from
-            :func:`generate_metadata_index`).
+        index_data: In-memory index data, e.g. from
+            :func:`generate_metadata_index`, a :class:`pyarrow.Buffer` or an
+            :class:`mmap.mmap`.  It is read in place, not copied.
+        read_mode: How *index_file_path* is read, see :func:`read_metadata`.
+        prepared: A column selection from :func:`prepare`, used instead of
+            *column_indices* and *column_names*.
+        project_arrow_schema: Restore the Arrow types from the projected
+            ``ARROW:schema``, see :func:`read_metadata`.
 
     Returns:
         A :class:`pyarrow.Schema` instance.
     """
     ...
+
+def prune_row_groups(
+    index: Union[IndexReader, str, _IndexData],
+    filter: _Filter,
+) -> List[int]:
+    """Find the row groups whose statistics don't rule out a filter.
+
+    The filter is evaluated against the min, max and null counts of every
+    row group, the rows themselves are never read.  The result is a superset
+    of the row groups with matching rows, for the ``row_groups`` argument of
+    :func:`read_metadata`.
+
+    Comparisons of a column with a literal (``==``, ``!=``, ``<``, ``<=``,
+    ``>``, ``>=``), ``is_in``, ``is_null``, ``is_valid`` and boolean columns
+    can prune row groups, combined with ``&``, ``|`` and ``~``.  Any other
+    part of the filter keeps all row groups.
+
+    Args:
+        index: An :class:`IndexReader`, or a path or in-memory index data to
+            open one with.
+        filter: A :class:`pyarrow.compute.Expression`, or filters in the
+            form of :func:`pyarrow.parquet.read_table`.
+
+    Returns:
+        The ids of the row groups that may have matching rows, in order.
+
+    Raises:
+        RuntimeError: If the index has no row group statistics.
+    """
+    ...
+
+def prepare(
+    index: Union[IndexReader, str, _IndexData],
+    column_indices: Sequence[int] = [],
+    column_names: Sequence[str] = [],
+) -> PreparedSelection:
+    """Resolve a column selection once, for reading many row-group selections.
+
+    The names are resolved and the schema is spliced here, so reads with the
+    result only splice the selected row groups.  The result can be used with
+    any index of a Parquet file with the same schema, and shared between
+    threads.  *column_indices* and *column_names* are mutually exclusive,
+    leaving both empty selects all columns.
+
+    Args:
+        index: An :class:`IndexReader`, or a path or in-memory index data to
+            open one with.
+        column_indices: Subset of column indices to select.
+        column_names: Subset of column names to select.
+
+    Returns:
+        A :class:`PreparedSelection` for the ``prepared`` argument of
+        :func:`read_metadata` and :func:`read_schema`.
+
+    Raises:
+        RuntimeError: If a read uses it with an index of a different schema.
+    """
+    ...
+
+def dataset(
+    paths: Sequence[str],
+    index_paths: Optional[Union[Sequence[Union[str, IndexReader]], IndexPack]] = None,
+    columns: Optional[Sequence[str]] = None,
+    filesystem: Optional[pa.fs.FileSystem] = None,
+    read_mode: str = 'full',
+) -> ds.FileSystemDataset:
+    """Build a :class:`pyarrow.dataset.Dataset` whose fragments get their
+    metadata from the indexes.
+
+    The projected metadata of every file is combined into an in-memory
+    ``_metadata`` file and opened with :func:`pyarrow.dataset.parquet_dataset`.
+    Fragment discovery, ``split_by_row_group``, filter pushdown on the row
+    group statistics and scans then never read the footers of the files.  The
+    dataset's filesystem wraps *filesystem* to serve that ``_metadata`` file,
+    the data files are opened and read by *filesystem* itself.
+
+    Args:
+        paths: Paths of the Parquet files.
+        index_paths: The index of every file, as a path or an
+            :class:`IndexReader`, or an :class:`IndexPack` keyed by *paths*.
+            ``None`` uses ``path + '.index'``.  Index paths are opened by
+            *filesystem* when it is given.
+        columns: The columns of the dataset, see *column_names* of
+            :func:`read_metadata`.  Filters can only use these columns.
+            ``None`` keeps all columns.
+        filesystem: The filesystem of the Parquet files, ``None`` uses the
+            local filesystem.
+        read_mode: How the index files are read, see :func:`read_metadata`.
+            Ignored when *filesystem* is given.
+
+    Raises:
+        ValueError: If *paths* is empty or *index_paths* has a different
+            length.
+    """
+    ...
+
+class PreparedSelection:
+    """A column selection resolved by :func:`prepare`."""
+
+    @property
+    def column_indices(self) -> List[int]:
+        """The selected column indices, empty if all columns are selected."""
+        ...
+
+class IndexReader:
+    """A handle to a previously generated index.
+
+    The index header is read and validated once, and the column-name lookup
+    table is built on first use, so repeated reads only pay for copying the
+    selected metadata.  A single instance can be shared between threads.
+    """
+
+    def __init__(
+        self,
+        source: Union[str, _IndexData],
+        read_mode: str = 'full',
+    ) -> None:
+        """Open an index.
+
+        Args:
+            source: Path to the index file, or in-memory index data (e.g. from
+                :func:`generate_metadata_index`).  In-memory data is
+                referenced, not copied.
+            read_mode: How the index file is read, see :func:`read_metadata`.
+                Ignored for in-memory index data.
+        """
+        ...
+
+    @property
+    def num_row_groups(self) -> int:
+        """Number of row groups in the indexed Parquet file."""
+        ...
+
+    @property
+    def num_columns(self) -> int:
+        """Number of columns in the indexed Parquet file."""
+        ...
+
+    @property
+    def num_rows(self) -> int:
+        """Number of rows in the indexed Parquet file."""
+        ...
+
+    def find_row_groups(self, start: int, stop: int) -> Tuple[List[int], int, int]:
+        """Find the row groups covering the rows ``[start, stop)`` of the file.
+
+        Binary searches the prefix sums of the row counts stored in the
+        index, built once per reader.
+
+        Args:
+            start: First row.
+            stop: Row after the last row, at most :attr:`num_rows`.
+
+        Returns:
+            The row groups, the number of rows to skip at the start of the
+            first one and the number of rows to read from the last one,
+            counted from its start.
+
+        Raises:
+            RuntimeError: If the range is empty or outside the file.
+        """
+        ...
+
+    @property
+    def sorted_key_column(self) -> Optional[int]:
+        """Index of the sorted key column, ``None`` if the index was generated without ``sorted_key_index``."""
+        ...
+
+    def find_row_groups_by_key(self, min: Any = None, max: Any = None) -> List[int]:
+        """Find the row groups that may have sort keys in ``[min, max]``.
+
+        Binary searches the min and max keys of the row groups stored by
+        ``sorted_key_index``, so the cost grows with the logarithm of the
+        number of row groups.  Row groups with only null keys are never
+        selected.
+
+        Args:
+            min: Smallest key, ``None`` leaves the range open.  Python values
+                are converted to the type of the key column, a
+                :class:`pyarrow.Scalar` is converted exactly (e.g. a
+                timestamp of another unit).
+            max: Largest key, ``None`` leaves the range open.
+
+        Returns:
+            The row groups in order.  Exact for numeric keys, for string keys
+            only the first 8 bytes are compared, so a few row groups next to
+            the range may be included.
+
+        Raises:
+            RuntimeError: If the index has no sorted key, or a key can't be
+                converted to the type of the key column.
+        """
+        ...
+
+    def read_metadata(
+        self,
+        row_groups: Sequence[int] = [],
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+        prepared: Optional[PreparedSelection] = None,
+        row_range: Optional[Tuple[int, int]] = None,
+        key_range: Optional[Tuple[Any, Any]] = None,
+        project_arrow_schema: bool = False,
+        strip: bool = False,
+    ) -> pq.FileMetaData:
+        """Read Parquet metadata for a subset of row groups and columns.
+
+        See :func:`read_metadata` for the arguments.
+        """
+        ...
+
+    def read_metadata_bytes(
+        self,
+        row_groups: Sequence[int] = [],
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+        prepared: Optional[PreparedSelection] = None,
+        row_range: Optional[Tuple[int, int]] = None,
+        key_range: Optional[Tuple[Any, Any]] = None,
+        project_arrow_schema: bool = False,
+        strip: bool = False,
+    ) -> pa.Buffer:
+        """Read the Thrift-encoded Parquet metadata without parsing it.
+
+        See :func:`read_metadata_bytes` for the arguments.
+        """
+        ...
+
+    def read_schema(
+        self,
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+        prepared: Optional[PreparedSelection] = None,
+        project_arrow_schema: bool = False,
+    ) -> pa.Schema:
+        """Read the Arrow schema for a subset of columns.
+
+        See :func:`read_schema` for the arguments.
+        """
+        ...
+
+    def prepare(
+        self,
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+    ) -> PreparedSelection:
+        """Resolve a column selection once, see :func:`prepare`."""
+        ...
+
+    @property
+    def has_row_group_statistics(self) -> bool:
+        """Whether the index was generated with ``row_group_statistics``."""
+        ...
+
+    def read_row_group_statistics(
+        self,
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+    ) -> pa.Table:
+        """Read the statistics of every row group for a subset of columns.
+
+        No Thrift is decoded, the arrays point into the index.
+
+        Args:
+            column_indices: Columns to read, by index.
+            column_names: Columns to read, by name.  Empty
+                *column_indices* and *column_names* read all columns.
+
+        Returns:
+            A table with one row per row group and a
+            ``struct<min, max, null_count>`` column per selected column, null
+            where the row group has no such statistic.  The
+            ``palletjack.statistics_type`` field metadata tells how min and
+            max are stored: ``int64`` (booleans, signed integers, dates,
+            times, timestamps and unscaled decimals), ``uint64``, ``double``,
+            ``bytes_prefix`` (strings and binaries, the first 8 bytes
+            zero-padded as a big-endian ``uint64``, which keeps their order
+            but not their uniqueness) or ``none`` (no usable order, min and
+            max are of the null type).
+
+        Raises:
+            RuntimeError: If the index has no row group statistics.
+        """
+        ...
+
+    def prune_row_groups(self, filter: _Filter) -> List[int]:
+        """Find the row groups whose statistics don't rule out a filter, see :func:`prune_row_groups`."""
+        ...
+
+class IndexPackBuilder:
+    """Collects indexes and writes them into a single index pack."""
+
+    def __len__(self) -> int: ...
+
+    def add(self, key: str, index_data: _IndexData) -> None:
+        """Add the index of a file.
+
+        Args:
+            key: The key the index is looked up by, e.g. the Parquet path.
+            index_data: The index, e.g. from :func:`generate_metadata_index`.
+                It is referenced, not copied, until the pack is written.
+
+        Raises:
+            RuntimeError: If *index_data* isn't an index.
+        """
+        ...
+
+    def finish(self, pack_path: Optional[str] = None) -> Optional[pa.Buffer]:
+        """Write the pack.
+
+        Args:
+            pack_path: Path of the pack file to write.  ``None`` returns the
+                pack as a :class:`pyarrow.Buffer` instead.
+
+        Raises:
+            RuntimeError: If a key was added more than once.
+        """
+        ...
+
+class IndexPack:
+    """A handle to an index pack written by :func:`generate_index_pack` or
+    :class:`IndexPackBuilder`.
+
+    The key directory is read and validated once, a key is found with a
+    fanout table and a binary search over the key hashes.  The indexes are
+    read in place from the pack and the reader of every file is opened once.
+    A single instance can be shared between threads.
+    """
+
+    def __init__(self, source: Union[str, _IndexData]) -> None:
+        """Open an index pack.
+
+        Args:
+            source: Path to the pack file, which is memory mapped, or
+                in-memory pack data, which is referenced, not copied.
+        """
+        ...
+
+    def __len__(self) -> int: ...
+    def __contains__(self, key: str) -> bool: ...
+
+    def keys(self) -> List[str]:
+        """The keys of the pack, in the order of their hashes."""
+        ...
+
+    def reader(self, key: str) -> IndexReader:
+        """The :class:`IndexReader` of the index of a file.
+
+        Raises:
+            KeyError: If the pack has no index for *key*.
+        """
+        ...
+
+    def read_metadata(
+        self,
+        file_key: str,
+        row_groups: Sequence[int] = [],
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+        prepared: Optional[PreparedSelection] = None,
+        row_range: Optional[Tuple[int, int]] = None,
+        key_range: Optional[Tuple[Any, Any]] = None,
+        project_arrow_schema: bool = False,
+        strip: bool = False,
+    ) -> pq.FileMetaData:
+        """Read Parquet metadata of a file for a subset of row groups and columns.
+
+        See :func:`read_metadata` for the arguments.
+        """
+        ...
+
+    def read_metadata_bytes(
+        self,
+        file_key: str,
+        row_groups: Sequence[int] = [],
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+        prepared: Optional[PreparedSelection] = None,
+        row_range: Optional[Tuple[int, int]] = None,
+        key_range: Optional[Tuple[Any, Any]] = None,
+        project_arrow_schema: bool = False,
+        strip: bool = False,
+    ) -> pa.Buffer:
+        """Read the Thrift-encoded Parquet metadata of a file without parsing it.
+
+        See :func:`read_metadata_bytes` for the arguments.
+        """
+        ...
+
+    def read_schema(
+        self,
+        file_key: str,
+        column_indices: Sequence[int] = [],
+        column_names: Sequence[str] = [],
+        prepared: Optional[PreparedSelection] = None,
+        project_arrow_schema: bool = False,
+    ) -> pa.Schema:
+        """Read the Arrow schema of a file for a subset of columns.
+
+        See :func:`read_schema` for the arguments.
+        """
+        ...
@@ -1,37 +1,102 @@
 # distutils: include_dirs = .
 
+import concurrent.futures
 import cython
+import os
+import posixpath
 import pyarrow as pa
+import pyarrow.dataset as ds
+import pyarrow.fs as pafs
 import pyarrow.parquet as pq
 from cython.cimports.palletjack import cpalletjack
 from libcpp.string cimport string
 from libcpp.memory cimport shared_ptr
 from libcpp.vector cimport vector
-from libc.stdint cimport uint32_t
+from libcpp.utility cimport pair
+from libc.stdint cimport uint32_t, int64_t
+from cython.operator cimport dereference as deref
 from pyarrow._parquet cimport *
+from pyarrow.lib cimport pyarrow_unwrap_buffer, pyarrow_wrap_buffer, pyarrow_unwrap_scalar
+from pyarrow._compute cimport Expression
 
-cpdef generate_metadata_index(parquet_path, index_file_path = None):
+cdef cpalletjack.IndexReadMode get_read_mode(read_mode) except *:
+    if read_mode == 'full':
+        return cpalletjack.IndexReadMode.ReadAll
+    if read_mode == 'ranges':
+        return cpalletjack.IndexReadMode.ReadRanges
+    if read_mode == 'mmap':
+        return cpalletjack.IndexReadMode.MemoryMap
+
+    raise ValueError(f"Unsupported read_mode='{read_mode}', expected 'full', 'ranges' or 'mmap'")
+
+# The name and the Arrow type of the min and max values of every palletjack::StatisticsType, indexed by its value
+STATISTICS_TYPES = (
+    ('none', pa.null()),
+    ('int64', pa.int64()),
+    ('uint64', pa.uint64()),
+    ('double', pa.float64()),
+    ('bytes_prefix', pa.uint64()),
+)
+
+cdef as_byte_view(index_data):
+    # Views any buffer-protocol object as unsigned bytes without copying (e.g. pyarrow.Buffer exports signed chars)
+    if index_data is None:
+        return None
+
+    return memoryview(index_data).cast('B')
+
+cpdef generate_metadata_index(parquet_path, index_file_path = None, column_names_hash = False, format_version = 0, packed_offsets = False, column_major_offsets = False, row_group_statistics = False, sorted_key_index = False, strip_ranges = False):
     cdef string encoded_parquet_path = parquet_path.encode('utf8')
     cdef string encoded_index_file_path = index_file_path.encode('utf8') if index_file_path is not None else "".encode('utf8')
-    cdef shared_ptr[cpalletjack.CArrowBuffer] c_buffer
+    cdef shared_ptr[cpalletjack.CBuffer] c_buffer
+    cdef cpalletjack.GenerateMetadataIndexOptions options
+    options.column_names_hash = column_names_hash
+    options.format_version = format_version
+    options.packed_offsets = packed_offsets
+    options.column_major_offsets = column_major_offsets
+    options.row_group_statistics = row_group_statistics
+    options.sorted_key_index = sorted_key_index
+    options.strip_ranges = strip_ranges
     if index_file_path is None:
         with nogil:
-            c_buffer = cpalletjack.GenerateMetadataIndex(encoded_parquet_path.c_str())
-        return bytearray((<const char*>c_buffer.get().data())[:c_buffer.get().size()])
+            c_buffer = cpalletjack.GenerateMetadataIndex(encoded_parquet_path.c_str(), options)
+        return pyarrow_wrap_buffer(c_buffer)
     else:
         with nogil:
-            cpalletjack.GenerateMetadataIndex(encoded_parquet_path.c_str(), encoded_index_file_path.c_str())
+            cpalletjack.GenerateMetadataIndex(encoded_parquet_path.c_str(), encoded_index_file_path.c_str(), options)
 
     return None
 
-cpdef read_metadata(index_file_path = None, row_groups = [], column_indices = [], column_names = [], index_data = None):
+cpdef generate_metadata_indexes(parquet_and_index_file_paths, num_threads = 0, memory_limit = 1 << 30, column_names_hash = False, format_version = 0, packed_offsets = False, column_major_offsets = False, row_group_statistics = False, sorted_key_index = False, strip_ranges = False):
+    cdef vector[pair[string, string]] cpaths = [(parquet_path.encode('utf8'), index_file_path.encode('utf8')) for (parquet_path, index_file_path) in parquet_and_index_file_paths]
+    cdef uint32_t cnum_threads = num_threads
+    cdef int64_t cmemory_limit = memory_limit
+    cdef cpalletjack.GenerateMetadataIndexOptions options
+    options.column_names_hash = column_names_hash
+    options.format_version = format_version
+    options.packed_offsets = packed_offsets
+    options.column_major_offsets = column_major_offsets
+    options.row_group_statistics = row_group_statistics
+    options.sorted_key_index = sorted_key_index
+    options.strip_ranges = strip_ranges
+    cdef vector[string] errors
+    with nogil:
+        errors = cpalletjack.GenerateMetadataIndexes(cpaths, cnum_threads, cmemory_limit, options)
+
+    return [error.decode('utf8') if error.size() > 0 else None for error in errors]
+
+cpdef read_metadata(index_file_path = None, row_groups = [], column_indices = [], column_names = [], index_data = None, read_mode = 'full', prepared = None, row_range = None, key_range = None, project_arrow_schema = False, strip = False):
+
+    if prepared is not None or row_range is not None or key_range is not None or project_arrow_schema or strip:
+        return IndexReader(index_file_path if index_file_path is not None else index_data, read_mode).read_metadata(row_groups, column_indices, column_names, prepared, row_range, key_range, project_arrow_schema, strip)
 
     cdef shared_ptr[CFileMetaData] c_metadata
     cdef string encoded_path = index_file_path.encode('utf8') if index_file_path is not None else "".encode('utf8')
-    cdef const unsigned char[::1] mv = index_data
+    cdef const unsigned char[::1] mv = as_byte_view(index_data)
     cdef vector[uint32_t] crow_groups = row_groups
     cdef vector[uint32_t] ccolumn_indices = column_indices
     cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+    cdef cpalletjack.IndexReadMode cread_mode = get_read_mode(read_mode)
 
     if index_file_path is None:
         with cython.boundscheck(False):
@@ -39,20 +104,27 @@ cpdef read_metadata(index_file_path = None, row_groups = [], column_indices = []
                 c_metadata = cpalletjack.ReadMetadata(&mv[0], len(mv), crow_groups, ccolumn_indices, ccolumn_names, False)
     else:
         with nogil:
-            c_metadata = cpalletjack.ReadMetadata(encoded_path.c_str(), crow_groups, ccolumn_indices, ccolumn_names, False)
+            c_metadata = cpalletjack.ReadMetadata(encoded_path.c_str(), crow_groups, ccolumn_indices, ccolumn_names, False, cread_mode)
 
     cdef FileMetaData m = FileMetaData.__new__(FileMetaData)
     m.init(c_metadata)
     return m
 
-cpdef read_schema(index_file_path = None, column_indices = [], column_names = [], index_data = None):
+cpdef read_metadata_bytes(index_file_path = None, row_groups = [], column_indices = [], column_names = [], index_data = None, read_mode = 'full', prepared = None, row_range = None, key_range = None, project_arrow_schema = False, strip = False):
+    return IndexReader(index_file_path if index_file_path is not None else index_data, read_mode).read_metadata_bytes(row_groups, column_indices, column_names, prepared, row_range, key_range, project_arrow_schema, strip)
+
+cpdef read_schema(index_file_path = None, column_indices = [], column_names = [], index_data = None, read_mode = 'full', prepared = None, project_arrow_schema = False):
+
+    if prepared is not None or project_arrow_schema:
+        return IndexReader(index_file_path if index_file_path is not None else index_data, read_mode).read_schema(column_indices, column_names, prepared, project_arrow_schema)
 
     cdef shared_ptr[CFileMetaData] c_metadata
     cdef string encoded_path = index_file_path.encode('utf8') if index_file_path is not None else "".encode('utf8')
-    cdef const unsigned char[::1] mv = index_data
+    cdef const unsigned char[::1] mv = as_byte_view(index_data)
     cdef vector[uint32_t] crow_groups
     cdef vector[uint32_t] ccolumn_indices = column_indices
     cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+    cdef cpalletjack.IndexReadMode cread_mode = get_read_mode(read_mode)
 
     if index_file_path is None:
         with cython.boundscheck(False):
@@ -60,8 +132,452 @@ cpdef read_schema(index_file_path = None, column_indices = [], column_names = []
                 c_metadata = cpalletjack.ReadMetadata(&mv[0], len(mv), crow_groups, ccolumn_indices, ccolumn_names, True)
     else:
         with nogil:
-            c_metadata = cpalletjack.ReadMetadata(encoded_path.c_str(), crow_groups, ccolumn_indices, ccolumn_names, True)
+            c_metadata = cpalletjack.ReadMetadata(encoded_path.c_str(), crow_groups, ccolumn_indices, ccolumn_names, True, cread_mode)
 
     cdef FileMetaData m = FileMetaData.__new__(FileMetaData)
     m.init(c_metadata)
     return m.schema.to_arrow_schema()
+
+cpdef prune_row_groups(index, filter):
+    if not isinstance(index, IndexReader):
+        index = IndexReader(index)
+
+    return index.prune_row_groups(filter)
+
+cpdef prepare(index, column_indices = [], column_names = []):
+    if not isinstance(index, IndexReader):
+        index = IndexReader(index)
+
+    return index.prepare(column_indices, column_names)
+
+cdef class PreparedSelection:
+
+    cdef shared_ptr[cpalletjack.CPreparedSelection] selection
+
+    def __init__(self):
+        raise TypeError("Use prepare() or IndexReader.prepare() to create a PreparedSelection")
+
+    @property
+    def column_indices(self):
+        return self.selection.get().column_indices()
+
+cdef check_prepared_columns(column_indices, column_names):
+    if len(column_indices) > 0 or len(column_names) > 0:
+        raise ValueError("Cannot specify column indices or column names together with a prepared selection!")
+
+cdef class IndexReader:
+
+    cdef shared_ptr[cpalletjack.CIndexReader] reader
+    cdef object index_data
+
+    def __init__(self, source, read_mode = 'full'):
+        cdef string encoded_path
+        cdef cpalletjack.IndexReadMode cread_mode = get_read_mode(read_mode)
+        cdef shared_ptr[cpalletjack.CBuffer] c_buffer
+
+        if isinstance(source, str):
+            encoded_path = source.encode('utf8')
+            with nogil:
+                self.reader = cpalletjack.CIndexReader.Open(encoded_path.c_str(), cread_mode)
+        else:
+            # Wraps the object without copying, the buffer keeps a reference to it
+            self.index_data = source if isinstance(source, pa.Buffer) else pa.py_buffer(source)
+            c_buffer = pyarrow_unwrap_buffer(self.index_data)
+            with nogil:
+                self.reader = cpalletjack.CIndexReader.Open(c_buffer)
+
+    @property
+    def num_row_groups(self):
+        return self.reader.get().num_row_groups()
+
+    @property
+    def num_columns(self):
+        return self.reader.get().num_columns()
+
+    @property
+    def num_rows(self):
+        return self.reader.get().num_rows()
+
+    cpdef find_row_groups(self, int64_t start, int64_t stop):
+
+        cdef cpalletjack.CRowRangeSelection selection
+        with nogil:
+            selection = self.reader.get().FindRowGroups(start, stop)
+
+        return (selection.row_groups, selection.first_row_group_offset, selection.last_row_group_stop)
+
+    cdef get_row_groups(self, row_groups, row_range, key_range):
+        if row_range is None and key_range is None:
+            return row_groups
+
+        if key_range is not None:
+            if len(row_groups) > 0 or row_range is not None:
+                raise ValueError("Cannot specify a key range together with row groups or a row range!")
+
+            return self.find_row_groups_by_key(key_range[0], key_range[1])
+
+        if len(row_groups) > 0:
+            raise ValueError("Cannot specify both row groups and a row range!")
+
+        return self.find_row_groups(row_range[0], row_range[1])[0]
+
+    @property
+    def sorted_key_column(self):
+        cdef optional[uint32_t] column = self.reader.get().sorted_key_column()
+        return column.value() if column.has_value() else None
+
+    cpdef find_row_groups_by_key(self, min = None, max = None):
+
+        cdef shared_ptr[cpalletjack.CScalar] cmin
+        cdef shared_ptr[cpalletjack.CScalar] cmax
+        cdef vector[uint32_t] row_groups
+
+        # Python values are converted to the type of the key column, pyarrow scalars are converted by the index
+        if (min is not None and not isinstance(min, pa.Scalar)) or (max is not None and not isinstance(max, pa.Scalar)):
+            column = self.sorted_key_column
+            key_type = self.read_schema([column]).field(0).type if column is not None else None
+            if min is not None and not isinstance(min, pa.Scalar):
+                min = pa.scalar(min, key_type)
+            if max is not None and not isinstance(max, pa.Scalar):
+                max = pa.scalar(max, key_type)
+
+        if min is not None:
+            cmin = pyarrow_unwrap_scalar(min)
+        if max is not None:
+            cmax = pyarrow_unwrap_scalar(max)
+
+        with nogil:
+            row_groups = self.reader.get().FindRowGroupsByKey(cmin, cmax)
+
+        return row_groups
+
+    cpdef prepare(self, column_indices = [], column_names = []):
+
+        cdef vector[uint32_t] ccolumn_indices = column_indices
+        cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+        cdef PreparedSelection p = PreparedSelection.__new__(PreparedSelection)
+
+        with nogil:
+            p.selection = self.reader.get().Prepare(ccolumn_indices, ccolumn_names)
+
+        return p
+
+    cpdef read_metadata(self, row_groups = [], column_indices = [], column_names = [], PreparedSelection prepared = None, row_range = None, key_range = None, bint project_arrow_schema = False, bint strip = False):
+
+        cdef shared_ptr[CFileMetaData] c_metadata
+        cdef vector[uint32_t] crow_groups = self.get_row_groups(row_groups, row_range, key_range)
+        # Empty row groups select all of them, a key range without row groups selects none
+        cdef bint no_row_groups = key_range is not None and crow_groups.size() == 0
+        cdef vector[uint32_t] ccolumn_indices = column_indices
+        cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+
+        if prepared is not None:
+            check_prepared_columns(column_indices, column_names)
+            with nogil:
+                c_metadata = self.reader.get().ReadMetadata(deref(prepared.selection), crow_groups, no_row_groups, project_arrow_schema, strip)
+        else:
+            with nogil:
+                c_metadata = self.reader.get().ReadMetadata(crow_groups, ccolumn_indices, ccolumn_names, no_row_groups, project_arrow_schema, strip)
+
+        cdef FileMetaData m = FileMetaData.__new__(FileMetaData)
+        m.init(c_metadata)
+        return m
+
+    cpdef read_metadata_bytes(self, row_groups = [], column_indices = [], column_names = [], PreparedSelection prepared = None, row_range = None, key_range = None, bint project_arrow_schema = False, bint strip = False):
+
+        cdef shared_ptr[cpalletjack.CBuffer] c_buffer
+        cdef vector[uint32_t] crow_groups = self.get_row_groups(row_groups, row_range, key_range)
+        # Empty row groups select all of them, a key range without row groups selects none
+        cdef bint no_row_groups = key_range is not None and crow_groups.size() == 0
+        cdef vector[uint32_t] ccolumn_indices = column_indices
+        cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+
+        if prepared is not None:
+            check_prepared_columns(column_indices, column_names)
+            with nogil:
+                c_buffer = self.reader.get().ReadMetadataBytes(deref(prepared.selection), crow_groups, no_row_groups, project_arrow_schema, strip)
+        else:
+            with nogil:
+                c_buffer = self.reader.get().ReadMetadataBytes(crow_groups, ccolumn_indices, ccolumn_names, no_row_groups, project_arrow_schema, strip)
+
+        return pyarrow_wrap_buffer(c_buffer)
+
+    cpdef read_schema(self, column_indices = [], column_names = [], PreparedSelection prepared = None, bint project_arrow_schema = False):
+
+        cdef shared_ptr[CFileMetaData] c_metadata
+        cdef vector[uint32_t] crow_groups
+        cdef vector[uint32_t] ccolumn_indices = column_indices
+        cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+
+        if prepared is not None:
+            check_prepared_columns(column_indices, column_names)
+            with nogil:
+                c_metadata = self.reader.get().ReadMetadata(deref(prepared.selection), crow_groups, True, project_arrow_schema, False)
+        else:
+            with nogil:
+                c_metadata = self.reader.get().ReadMetadata(crow_groups, ccolumn_indices, ccolumn_names, True, project_arrow_schema, False)
+
+        cdef FileMetaData m = FileMetaData.__new__(FileMetaData)
+        m.init(c_metadata)
+        return m.schema.to_arrow_schema()
+
+    cdef read_parquet_schema(self, column_indices, column_names):
+
+        cdef shared_ptr[CFileMetaData] c_metadata
+        cdef vector[uint32_t] crow_groups
+        cdef vector[uint32_t] ccolumn_indices = column_indices
+        cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+
+        with nogil:
+            c_metadata = self.reader.get().ReadMetadata(crow_groups, ccolumn_indices, ccolumn_names, True, False, False)
+
+        cdef FileMetaData m = FileMetaData.__new__(FileMetaData)
+        m.init(c_metadata)
+        return m.schema
+
+    @property
+    def has_row_group_statistics(self):
+        return self.reader.get().has_row_group_statistics()
+
+    cpdef read_row_group_statistics(self, column_indices = [], column_names = []):
+
+        cdef vector[uint32_t] ccolumn_indices = column_indices
+        cdef vector[string] ccolumn_names = [c.encode('utf8') for c in column_names]
+        cdef vector[cpalletjack.CColumnStatistics] statistics
+        cdef int64_t row_groups = self.reader.get().num_row_groups()
+
+        with nogil:
+            statistics = self.reader.get().ReadRowGroupStatistics(ccolumn_indices, ccolumn_names)
+
+        # The paths of the leaf columns, a group name of a nested schema selects all of its leaves
+        parquet_schema = self.read_parquet_schema(column_indices, column_names)
+        names = [parquet_schema.column(i).path for i in range(len(parquet_schema))]
+        fields = []
+        arrays = []
+        for i in range(statistics.size()):
+            statistics_type, value_type = STATISTICS_TYPES[<int>statistics[i].type]
+            if statistics_type == 'none':
+                min_array = max_array = pa.nulls(row_groups, value_type)
+                null_count_array = pa.nulls(row_groups, pa.int64())
+            else:
+                # The arrays point into the index, nothing is copied
+                has_min_max = pyarrow_wrap_buffer(statistics[i].has_min_max)
+                min_array = pa.Array.from_buffers(value_type, row_groups, [has_min_max, pyarrow_wrap_buffer(statistics[i].min)])
+                max_array = pa.Array.from_buffers(value_type, row_groups, [has_min_max, pyarrow_wrap_buffer(statistics[i].max)])
+                null_count_array = pa.Array.from_buffers(pa.int64(), row_groups, [pyarrow_wrap_buffer(statistics[i].has_null_count), pyarrow_wrap_buffer(statistics[i].null_count)])
+
+            arrays.append(pa.StructArray.from_arrays([min_array, max_array, null_count_array], names = ['min', 'max', 'null_count']))
+            fields.append(pa.field(names[i], arrays[-1].type, metadata = {'palletjack.statistics_type': statistics_type}))
+
+        return pa.Table.from_arrays(arrays, schema = pa.schema(fields))
+
+    cpdef prune_row_groups(self, filter):
+
+        if not isinstance(filter, Expression):
+            filter = pq.filters_to_expression(filter)
+
+        cdef cpalletjack.CRowGroupFilter cfilter = cpalletjack.CRowGroupFilter.FromExpression((<Expression>filter).expr)
+        cdef vector[uint32_t] row_groups
+
+        with nogil:
+            row_groups = self.reader.get().PruneRowGroups(cfilter)
+
+        return row_groups
+
+def generate_index_pack(parquet_paths, pack_path = None, keys = None, num_threads = 0, column_names_hash = False, format_version = 0, packed_offsets = False, column_major_offsets = False, row_group_statistics = False, sorted_key_index = False, strip_ranges = False):
+    keys = parquet_paths if keys is None else keys
+    if len(keys) != len(parquet_paths):
+        raise ValueError("Expected a key for every parquet path!")
+
+    # The indexes are generated in memory without the GIL, so the threads run in parallel
+    generate = lambda parquet_path: generate_metadata_index(parquet_path, column_names_hash = column_names_hash, format_version = format_version, packed_offsets = packed_offsets,
+                                                            column_major_offsets = column_major_offsets, row_group_statistics = row_group_statistics, sorted_key_index = sorted_key_index, strip_ranges = strip_ranges)
+    with concurrent.futures.ThreadPoolExecutor(max_workers = num_threads if num_threads > 0 else None) as pool:
+        indexes = list(pool.map(generate, parquet_paths))
+
+    builder = IndexPackBuilder()
+    for key, index_data in zip(keys, indexes):
+        builder.add(key, index_data)
+
+    return builder.finish(pack_path)
+
+cdef class IndexPackBuilder:
+
+    cdef cpalletjack.CIndexPackBuilder builder
+
+    def __len__(self):
+        return self.builder.size()
+
+    cpdef add(self, key, index_data):
+        cdef string ckey = key.encode('utf8')
+        cdef shared_ptr[cpalletjack.CBuffer] c_buffer = pyarrow_unwrap_buffer(index_data if isinstance(index_data, pa.Buffer) else pa.py_buffer(index_data))
+        with nogil:
+            self.builder.Add(ckey, c_buffer)
+
+    cpdef finish(self, pack_path = None):
+        cdef string encoded_pack_path
+        cdef shared_ptr[cpalletjack.CBuffer] c_buffer
+        if pack_path is None:
+            with nogil:
+                c_buffer = self.builder.Finish()
+            return pyarrow_wrap_buffer(c_buffer)
+
+        encoded_pack_path = pack_path.encode('utf8')
+        with nogil:
+            self.builder.Finish(encoded_pack_path.c_str())
+
+        return None
+
+cdef class IndexPack:
+
+    cdef shared_ptr[cpalletjack.CIndexPack] pack
+    cdef object pack_data
+
+    def __init__(self, source):
+        cdef string encoded_path
+        cdef shared_ptr[cpalletjack.CBuffer] c_buffer
+
+        if isinstance(source, str):
+            encoded_path = source.encode('utf8')
+            with nogil:
+                self.pack = cpalletjack.CIndexPack.Open(encoded_path.c_str())
+        else:
+            # Wraps the object without copying, the buffer keeps a reference to it
+            self.pack_data = source if isinstance(source, pa.Buffer) else pa.py_buffer(source)
+            c_buffer = pyarrow_unwrap_buffer(self.pack_data)
+            with nogil:
+                self.pack = cpalletjack.CIndexPack.Open(c_buffer)
+
+    def __len__(self):
+        return self.pack.get().num_files()
+
+    def __contains__(self, key):
+        return self.pack.get().Contains(key.encode('utf8'))
+
+    def keys(self):
+        cdef vector[string] ckeys = self.pack.get().keys()
+        return [key.decode('utf8') for key in ckeys]
+
+    cpdef reader(self, key):
+        cdef string ckey = key.encode('utf8')
+        if not self.pack.get().Contains(ckey):
+            raise KeyError(key)
+
+        cdef IndexReader r = IndexReader.__new__(IndexReader)
+        with nogil:
+            r.reader = self.pack.get().GetReader(ckey)
+        r.index_data = self.pack_data
+        return r
+
+    def read_metadata(self, file_key, *args, **kwargs):
+        return self.reader(file_key).read_metadata(*args, **kwargs)
+
+    def read_metadata_bytes(self, file_key, *args, **kwargs):
+        return self.reader(file_key).read_metadata_bytes(*args, **kwargs)
+
+    def read_schema(self, file_key, *args, **kwargs):
+        return self.reader(file_key).read_schema(*args, **kwargs)
+
+class _MetadataFileSystemHandler(pafs.FileSystemHandler):
+    # Serves an in-memory _metadata file at metadata_path and passes everything else to the wrapped filesystem,
+    # the data files are opened by the wrapped filesystem and read without going through Python
+
+    def __init__(self, filesystem, metadata_path, metadata_buffer):
+        self.filesystem = filesystem
+        self.metadata_path = metadata_path
+        self.metadata_buffer = metadata_buffer
+
+    def __eq__(self, other):
+        return isinstance(other, _MetadataFileSystemHandler) and self.filesystem.equals(other.filesystem) and self.metadata_path == other.metadata_path and self.metadata_buffer.equals(other.metadata_buffer)
+
+    def __ne__(self, other):
+        return not self == other
+
+    def get_type_name(self):
+        return 'palletjack+' + self.filesystem.type_name
+
+    def normalize_path(self, path):
+        return self.filesystem.normalize_path(path)
+
+    def get_file_info(self, paths):
+        return [pafs.FileInfo(path, pafs.FileType.File, size = self.metadata_buffer.size) if path == self.metadata_path else self.filesystem.get_file_info(path) for path in paths]
+
+    def get_file_info_selector(self, selector):
+        return self.filesystem.get_file_info(selector)
+
+    def create_dir(self, path, recursive):
+        self.filesystem.create_dir(path, recursive = recursive)
+
+    def delete_dir(self, path):
+        self.filesystem.delete_dir(path)
+
+    def delete_dir_contents(self, path, missing_dir_ok = False):
+        self.filesystem.delete_dir_contents(path, missing_dir_ok = missing_dir_ok)
+
+    def delete_root_dir_contents(self):
+        self.filesystem.delete_dir_contents('/', accept_root_dir = True)
+
+    def delete_file(self, path):
+        self.filesystem.delete_file(path)
+
+    def move(self, src, dest):
+        self.filesystem.move(src, dest)
+
+    def copy_file(self, src, dest):
+        self.filesystem.copy_file(src, dest)
+
+    def open_input_stream(self, path):
+        return pa.BufferReader(self.metadata_buffer) if path == self.metadata_path else self.filesystem.open_input_stream(path)
+
+    def open_input_file(self, path):
+        return pa.BufferReader(self.metadata_buffer) if path == self.metadata_path else self.filesystem.open_input_file(path)
+
+    def open_output_stream(self, path, metadata):
+        return self.filesystem.open_output_stream(path, metadata = metadata)
+
+    def open_append_stream(self, path, metadata):
+        return self.filesystem.open_append_stream(path, metadata = metadata)
+
+def dataset(paths, index_paths = None, columns = None, filesystem = None, read_mode = 'full'):
+    if index_paths is None:
+        index_paths = [path + '.index' for path in paths]
+    elif isinstance(index_paths, IndexPack):
+        index_paths = [index_paths.reader(path) for path in paths]
+
+    # Index paths are read through the caller's filesystem, the local ones honour read_mode
+    index_filesystem = filesystem
+    if filesystem is None:
+        filesystem = pafs.LocalFileSystem()
+        paths = [os.path.abspath(path).replace(os.sep, '/') for path in paths]
+
+    if len(index_paths) != len(paths):
+        raise ValueError("Expected an index for every parquet path!")
+
+    if len(paths) == 0:
+        raise ValueError("Expected at least one parquet path!")
+
+    # The projected metadata of all files becomes a single _metadata file, which Arrow splits into fragments
+    # that keep their metadata, so the footers of the files are never read
+    column_names = columns if columns is not None else []
+    base_dir = posixpath.commonpath([posixpath.dirname(path) for path in paths])
+    metadata = None
+    for path, index in zip(paths, index_paths):
+        if isinstance(index, IndexReader):
+            reader = index
+        elif index_filesystem is not None:
+            with index_filesystem.open_input_file(index) as f:
+                reader = IndexReader(f.read_buffer())
+        else:
+            reader = IndexReader(index, read_mode)
+        file_metadata = reader.read_metadata(column_names = column_names, project_arrow_schema = True)
+        file_metadata.set_file_path(posixpath.relpath(path, base_dir))
+        if metadata is None:
+            metadata = file_metadata
+        else:
+            metadata.append_row_groups(file_metadata)
+
+    sink = pa.BufferOutputStream()
+    metadata.write_metadata_file(sink)
+    metadata_path = posixpath.join(base_dir, '_palletjack_metadata')
+    handler = _MetadataFileSystemHandler(filesystem, metadata_path, sink.getvalue())
+    return ds.parquet_dataset(metadata_path, filesystem = pafs.PyFileSystem(handler))
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// The parts of the thrift compact protocol encoding palletjack writes, so splicing needs no thrift runtime objects.
+// The Write functions write at dst and return the end of what they wrote.
+namespace thrift_compact
+{
+
+// Compact protocol types
+enum Type : uint8_t
+{
+    CT_STOP = 0,
+    CT_BOOLEAN_TRUE = 1,
+    CT_BOOLEAN_FALSE = 2,
+    CT_BYTE = 3,
+    CT_I16 = 4,
+    CT_I32 = 5,
+    CT_I64 = 6,
+    CT_DOUBLE = 7,
+    CT_BINARY = 8,
+    CT_LIST = 9,
+    CT_SET = 10,
+    CT_MAP = 11,
+    CT_STRUCT = 12,
+    CT_UUID = 13,
+};
+
+constexpr size_t kMaxVarintLength = 10;                        // 64-bit value
+constexpr size_t kMaxListBeginLength = 1 + kMaxVarintLength / 2; // header byte and a 32-bit size
+
+inline uint8_t *WriteVarint(uint8_t *dst, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *dst++ = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+
+    *dst++ = static_cast<uint8_t>(value);
+    return dst;
+}
+
+inline uint8_t *WriteI32(uint8_t *dst, int32_t value)
+{
+    return WriteVarint(dst, (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+}
+
+inline uint8_t *WriteI64(uint8_t *dst, int64_t value)
+{
+    return WriteVarint(dst, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+// Sizes below 15 are stored in the high nibble of the header byte, bigger ones follow it as a varint
+inline uint8_t *WriteListBegin(uint8_t *dst, Type element_type, uint32_t size)
+{
+    if (size < 15)
+    {
+        *dst++ = static_cast<uint8_t>(size << 4) | element_type;
+        return dst;
+    }
+
+    *dst++ = 0xf0 | element_type;
+    return WriteVarint(dst, size);
+}
+
+} // namespace thrift_compact
@@ -6,10 +6,14 @@ import palletjack as pj
 import pyarrow.parquet as pq
 import pyarrow.parquet.encryption as pe
 import pyarrow as pa
+import pyarrow.compute as pc
 import numpy as np
 import itertools as it
 import pyarrow.fs as fs
+import concurrent.futures
 import os
+import struct
+import mmap
 
 n_row_groups = 5
 n_columns = 7
@@ -76,8 +80,13 @@ class TestPalletJack(unittest.TestCase):
             metadata_names_data = pj.read_metadata(index_data = fs.LocalFileSystem().open_input_stream(index_path).readall()
                                                    , row_groups=row_groups, column_names=[f'column_{i}' for i in column_indices])
             
+            metadata_ranges = pj.read_metadata(index_path, row_groups=row_groups, column_indices=column_indices, read_mode='ranges')
+            metadata_mmap = pj.read_metadata(index_path, row_groups=row_groups, column_indices=column_indices, read_mode='mmap')
+
             self.assertEqual(metadata, metadata_names, f"row_groups={row_groups}, column_indices={column_indices}")
             self.assertEqual(metadata_names_data, metadata_names, f"row_groups={row_groups}, column_indices={column_indices}")
+            self.assertEqual(metadata_ranges, metadata, f"row_groups={row_groups}, column_indices={column_indices}")
+            self.assertEqual(metadata_mmap, metadata, f"row_groups={row_groups}, column_indices={column_indices}")
 
             pr.close()
 
@@ -152,6 +161,660 @@ class TestPalletJack(unittest.TestCase):
 
             pr.close()
 
+    def test_read_metadata_read_modes(self):
+        for file_name, read_mode in it.product(['golden_master.parquet', 'no_column_orders.parquet'], ['ranges', 'mmap']):
+            with tempfile.TemporaryDirectory() as tmpdirname:
+                path = os.path.join(current_dir, 'data', file_name)
+                index_path = os.path.join(tmpdirname, file_name + '.index')
+                pj.generate_metadata_index(path, index_path)
+
+                pr = pq.ParquetReader()
+                pr.open(path)
+                num_row_groups = pr.metadata.num_row_groups
+                num_columns = pr.metadata.num_columns
+                column_names = pr.metadata.schema.names
+                self.assertEqual(pr.metadata, pj.read_metadata(index_path, read_mode=read_mode))
+                pr.close()
+
+                row_groups_columns = [
+                    ([], []),
+                    ([0], []),
+                    ([], [num_columns - 1]),
+                    ([num_row_groups - 1, 0], [num_columns - 1, 0]),
+                    (range(num_row_groups), range(num_columns)),
+                ]
+
+                for (row_groups, columns) in row_groups_columns:
+                    msg = f"file={file_name}, read_mode={read_mode}, row_groups={row_groups}, columns={columns}"
+                    expected = pj.read_metadata(index_path, row_groups=row_groups, column_indices=columns)
+                    actual = pj.read_metadata(index_path, row_groups=row_groups, column_indices=columns, read_mode=read_mode)
+                    self.assertEqual(expected, actual, msg)
+
+                    names = [column_names[c] for c in columns]
+                    actual = pj.read_metadata(index_path, row_groups=row_groups, column_names=names, read_mode=read_mode)
+                    self.assertEqual(expected, actual, msg)
+
+                self.assertEqual(pj.read_schema(index_path), pj.read_schema(index_path, read_mode=read_mode))
+
+                with self.assertRaises(RuntimeError) as context:
+                    pj.read_metadata(index_path, row_groups=[num_row_groups], read_mode=read_mode)
+                self.assertTrue(f"Requested row_group={num_row_groups}, but only 0-{num_row_groups-1} are available!" in str(context.exception), context.exception)
+
+                with self.assertRaises(ValueError) as context:
+                    pj.read_metadata(index_path, read_mode='no_such_mode')
+                self.assertTrue("Unsupported read_mode='no_such_mode'" in str(context.exception), context.exception)
+
+    def test_index_reader(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(current_dir, 'data/golden_master.parquet')
+            index_path = os.path.join(tmpdirname, 'golden_master.parquet.index')
+            pj.generate_metadata_index(path, index_path)
+            index_data = pj.generate_metadata_index(path)
+
+            pr = pq.ParquetReader()
+            pr.open(path)
+            expected_metadata = pr.metadata
+            pr.close()
+
+            readers = [pj.IndexReader(index_path), pj.IndexReader(index_data), pj.IndexReader(bytes(index_data))]
+            readers.extend(pj.IndexReader(index_path, read_mode=read_mode) for read_mode in ['full', 'ranges', 'mmap'])
+
+            column_names = expected_metadata.schema.names
+            selections = [([], []), ([1], []), ([], [2, 0]), ([0, 1], [1])]
+            for reader in readers:
+                self.assertEqual(reader.num_row_groups, expected_metadata.num_row_groups)
+                self.assertEqual(reader.num_columns, expected_metadata.num_columns)
+                self.assertEqual(reader.read_metadata(), expected_metadata)
+                self.assertEqual(reader.read_schema(), expected_metadata.schema.to_arrow_schema())
+
+                for (row_groups, columns) in selections:
+                    expected = pj.read_metadata(index_path, row_groups=row_groups, column_indices=columns)
+                    self.assertEqual(reader.read_metadata(row_groups=row_groups, column_indices=columns), expected)
+                    self.assertEqual(reader.read_metadata(row_groups=row_groups, column_names=[column_names[c] for c in columns]), expected)
+                    self.assertEqual(reader.read_schema(column_indices=columns), pj.read_schema(index_path, column_indices=columns))
+
+                with self.assertRaises(RuntimeError) as context:
+                    reader.read_metadata(column_names=["no_such_column"])
+                self.assertTrue("Couldn't find a column with a name 'no_such_column'!" in str(context.exception), context.exception)
+
+    def test_prepared_selection(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            paths = [os.path.join(tmpdirname, f"my{i}.parquet") for i in range(3)]
+            for path in paths:
+                pq.write_table(get_table(), path, row_group_size=chunk_size)
+                pj.generate_metadata_index(path, path + '.index')
+
+            prepared = pj.prepare(paths[0] + '.index', column_names=['column_5', 'column_2'])
+            self.assertEqual(prepared.column_indices, [5, 2])
+
+            # The selection is prepared once and used with every file of the same schema
+            for path in paths:
+                for reader in [pj.IndexReader(path + '.index'), pj.IndexReader(path + '.index', read_mode='ranges')]:
+                    for row_groups in [[], [3], [4, 0]]:
+                        expected = reader.read_metadata(row_groups=row_groups, column_indices=[5, 2])
+                        self.assertEqual(reader.read_metadata(row_groups=row_groups, prepared=prepared), expected)
+                        self.assertEqual(pj.read_metadata(path + '.index', row_groups=row_groups, prepared=prepared), expected)
+
+                    self.assertEqual(reader.read_schema(prepared=prepared), reader.read_schema(column_indices=[5, 2]))
+                    all_columns = reader.prepare()
+                    self.assertEqual(reader.read_metadata(prepared=all_columns), reader.read_metadata())
+
+            with self.assertRaises(ValueError) as context:
+                pj.read_metadata(paths[0] + '.index', column_indices=[1], prepared=prepared)
+            self.assertTrue("Cannot specify column indices or column names together with a prepared selection!" in str(context.exception), context.exception)
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.read_metadata(paths[0] + '.index', row_groups=[n_row_groups], prepared=prepared)
+            self.assertTrue(f"Requested row_group={n_row_groups}, but only 0-{n_row_groups - 1} are available!" in str(context.exception), context.exception)
+
+            other_path = os.path.join(tmpdirname, "other.parquet")
+            pq.write_table(get_table().drop_columns(['column_0']), other_path, row_group_size=chunk_size)
+            with self.assertRaises(RuntimeError) as context:
+                pj.read_metadata(index_data=pj.generate_metadata_index(other_path), prepared=prepared)
+            self.assertTrue("The prepared selection doesn't match the schema of the index!" in str(context.exception), context.exception)
+
+    def test_read_metadata_bytes(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(current_dir, 'data/golden_master.parquet')
+            index_path = os.path.join(tmpdirname, 'golden_master.parquet.index')
+            pj.generate_metadata_index(path, index_path)
+            reader = pj.IndexReader(index_path)
+            prepared = reader.prepare(column_indices=[2, 0])
+
+            for (row_groups, columns) in [([], []), ([1], []), ([], [2, 0]), ([0, 1], [1])]:
+                expected = pj.read_metadata(index_path, row_groups=row_groups, column_indices=columns)
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    metadata_bytes = pj.read_metadata_bytes(index_path, row_groups=row_groups, column_indices=columns, read_mode=read_mode)
+                    self.assertIsInstance(metadata_bytes, pa.Buffer)
+
+                    # The bytes are the thrift FileMetaData, as stored in a parquet footer
+                    footer = b'PAR1' + metadata_bytes.to_pybytes() + struct.pack('<I', metadata_bytes.size) + b'PAR1'
+                    self.assertEqual(pq.read_metadata(pa.BufferReader(footer)), expected)
+
+                self.assertEqual(reader.read_metadata_bytes(row_groups=row_groups, column_indices=columns), metadata_bytes)
+
+            self.assertEqual(reader.read_metadata_bytes(row_groups=[1], prepared=prepared), reader.read_metadata_bytes(row_groups=[1], column_indices=[2, 0]))
+
+    def test_row_range(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            with pq.ParquetWriter(path, pa.schema([('a', pa.int64())])) as writer:
+                for n in [3, 0, 5, 1, 2]:
+                    writer.write_table(pa.table({'a': pa.array(range(n), pa.int64())}))
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path)
+
+            reader = pj.IndexReader(index_path)
+            self.assertEqual(reader.num_rows, 11)
+            self.assertEqual(reader.find_row_groups(0, 11), ([0, 1, 2, 3, 4], 0, 2))
+            self.assertEqual(reader.find_row_groups(2, 4), ([0, 1, 2], 2, 1))
+            self.assertEqual(reader.find_row_groups(3, 8), ([2], 0, 5))
+            self.assertEqual(reader.find_row_groups(8, 10), ([3, 4], 0, 1))
+            self.assertEqual(reader.find_row_groups(10, 11), ([4], 1, 2))
+
+            expected = pj.read_metadata(index_path, row_groups=[2, 3], column_indices=[0])
+            self.assertEqual(pj.read_metadata(index_path, row_range=(4, 9), column_indices=[0]), expected)
+            self.assertEqual(reader.read_metadata(row_range=(4, 9), column_indices=[0]), expected)
+            self.assertEqual(reader.read_metadata_bytes(row_range=(4, 9)), reader.read_metadata_bytes(row_groups=[2, 3]))
+
+            for (start, stop) in [(-1, 3), (3, 3), (4, 2), (0, 12)]:
+                with self.assertRaises(RuntimeError) as context:
+                    reader.find_row_groups(start, stop)
+                self.assertTrue(f"Requested rows=[{start}, {stop}), but only rows=[0, 11) are available!" in str(context.exception), context.exception)
+
+            with self.assertRaises(ValueError) as context:
+                reader.read_metadata(row_groups=[1], row_range=(0, 1))
+            self.assertTrue("Cannot specify both row groups and a row range!" in str(context.exception), context.exception)
+
+    def test_row_group_statistics(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            n = 40
+            table = pa.table({
+                'int32': pa.array([i if i % 7 else None for i in range(n)], pa.int32()),
+                'int64': pa.array([-1000 * i for i in range(n)], pa.int64()),
+                'uint32': pa.array([4000000000 - i for i in range(n)], pa.uint32()),
+                'float': pa.array([i / 3 for i in range(n)], pa.float32()),
+                'double': pa.array([float('nan') if i == 3 else -float(i) for i in range(n)], pa.float64()),
+                'bool': pa.array([i % 2 == 0 for i in range(n)]),
+                'timestamp': pa.array([i * 10**6 for i in range(n)], pa.timestamp('us')),
+                'string': pa.array([f'value_{i:03d}' for i in range(n)]),
+                'decimal': pa.array(range(n), pa.decimal128(20, 2)),
+                'nulls': pa.array([None] * n, pa.int64()),
+            })
+            pq.write_table(table, path, row_group_size=10)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path, row_group_statistics=True)
+
+            def prefix(value):
+                return int.from_bytes(value.encode('utf8')[:8].ljust(8, b'\0'), 'big')
+
+            metadata = pq.read_metadata(path)
+            statistics = pj.IndexReader(index_path).read_row_group_statistics()
+            self.assertEqual(statistics.column_names, table.column_names)
+            self.assertEqual(statistics.num_rows, metadata.num_row_groups)
+            for c, name in enumerate(table.column_names):
+                field = statistics.schema.field(name)
+                statistics_type = field.metadata[b'palletjack.statistics_type'].decode()
+                self.assertEqual(statistics_type, {'uint32': 'uint64', 'float': 'double', 'double': 'double', 'string': 'bytes_prefix', 'decimal': 'none'}.get(name, 'int64'), name)
+                for r in range(metadata.num_row_groups):
+                    expected = metadata.row_group(r).column(c).statistics
+                    actual = statistics.column(name)[r].as_py()
+                    if statistics_type == 'none':
+                        self.assertEqual(actual, {'min': None, 'max': None, 'null_count': None})
+                        continue
+
+                    self.assertEqual(actual['null_count'], expected.null_count, name)
+                    if not expected.has_min_max:
+                        self.assertEqual((actual['min'], actual['max']), (None, None), name)
+                    elif name == 'string':
+                        self.assertEqual((actual['min'], actual['max']), (prefix(expected.min), prefix(expected.max)))
+                    elif name == 'timestamp':
+                        self.assertEqual((actual['min'], actual['max']), (expected.min_raw, expected.max_raw))
+                    else:
+                        self.assertEqual((actual['min'], actual['max']), (expected.min, expected.max), name)
+
+            for read_mode in ['full', 'ranges', 'mmap']:
+                reader = pj.IndexReader(index_path, read_mode=read_mode)
+                self.assertTrue(reader.has_row_group_statistics)
+                self.assertEqual(reader.read_row_group_statistics(column_indices=[7, 0]), statistics.select([7, 0]), read_mode)
+                self.assertEqual(reader.read_row_group_statistics(column_names=['string', 'int32']), statistics.select([7, 0]), read_mode)
+
+            # The section doesn't change the metadata read from the index
+            index_data = pj.generate_metadata_index(path, row_group_statistics=True, packed_offsets=True)
+            self.assertEqual(pj.read_metadata(index_data=index_data, row_groups=[1, 3], column_indices=[2]), pj.read_metadata(index_path, row_groups=[1, 3], column_indices=[2]))
+            self.assertEqual(pj.IndexReader(index_data).read_row_group_statistics(), statistics)
+
+            reader = pj.IndexReader(pj.generate_metadata_index(path))
+            self.assertFalse(reader.has_row_group_statistics)
+            with self.assertRaises(RuntimeError) as context:
+                reader.read_row_group_statistics()
+            self.assertTrue("The index has no row group statistics" in str(context.exception), context.exception)
+
+    def test_prune_row_groups(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            n = 100
+            table = pa.table({
+                'int32': pa.array([i if i % 7 else None for i in range(n)], pa.int32()),
+                'uint64': pa.array(range(n), pa.uint64()),
+                'double': pa.array([float('nan') if i % 13 == 0 else i / 2 for i in range(n)]),
+                'bool': pa.array([i >= 50 for i in range(n)]),
+                'timestamp': pa.array([i * 1000 for i in range(n)], pa.timestamp('ms')),
+                'string': pa.array([f'value_{i:03d}' for i in range(n)]),
+                'nulls': pa.array([None if i < 25 else i for i in range(n)], pa.int64()),
+            })
+            pq.write_table(table, path, row_group_size=10)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path, row_group_statistics=True)
+
+            f = pc.field
+            filters = [
+                (f('int32') == 15, [1]),
+                (f('int32') > 75, [7, 8, 9]),
+                (42 > f('int32'), [0, 1, 2, 3, 4]),
+                (~(f('int32') < 80), [8, 9]),
+                (f('int32').isin([3, 55]), [0, 5]),
+                ((f('int32') > 35) & (f('uint64') <= 50), [3, 4, 5]),
+                ((f('uint64') < 5) | (f('string') >= 'value_095'), [0, 9]),
+                (f('uint64') >= 1.5, list(range(10))),
+                (f('double') == 30.0, [6]),
+                (f('double') != 30.0, list(range(10))),
+                (f('bool'), [5, 6, 7, 8, 9]),
+                (~f('bool'), [0, 1, 2, 3, 4]),
+                (f('timestamp') < pa.scalar(20, pa.timestamp('s')), [0, 1]),
+                (f('string') == 'value_042', [4]),
+                (f('nulls').is_null(), [0, 1, 2]),
+                (~f('nulls').is_null(), [2, 3, 4, 5, 6, 7, 8, 9]),
+                (f('nulls') == 1, []),
+                (f('nulls') <= 30, [2, 3]),
+                # Not supported, all row groups are kept
+                (f('int32') + 1 > 75, list(range(10))),
+                (f('int32') == f('uint64'), list(range(10))),
+            ]
+
+            rows = table.append_column('row', pa.array(range(n)))
+            for read_mode in ['full', 'ranges', 'mmap']:
+                reader = pj.IndexReader(index_path, read_mode=read_mode)
+                for (filter, expected) in filters:
+                    self.assertEqual(reader.prune_row_groups(filter), expected, filter)
+
+                    # The kept row groups hold all the matching rows
+                    matching = {r // 10 for r in rows.filter(filter)['row'].to_pylist()}
+                    self.assertTrue(matching <= set(expected), filter)
+
+            self.assertEqual(pj.prune_row_groups(index_path, [('uint64', '>', 84), ('bool', '=', True)]), [8, 9])
+            metadata = pj.read_metadata(index_path, row_groups=pj.prune_row_groups(index_path, f('int32') == 15))
+            self.assertEqual(metadata.num_rows, 10)
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.prune_row_groups(pj.generate_metadata_index(path), f('int32') == 15)
+            self.assertTrue("The index has no row group statistics" in str(context.exception), context.exception)
+
+    def test_sorted_key_index(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            n = 200
+            # The first row group has only null keys
+            table = pa.table({
+                'timestamp': pa.array([None if i < 10 else i * 60000 for i in range(n)], pa.timestamp('ms')),
+                'double': pa.array([float(n - i) for i in range(n)]),
+                'string': pa.array([f'key_{i:03d}' for i in range(n)]),
+            })
+
+            def expected_row_groups(column, min, max):
+                values = table[column].to_pylist()
+                return sorted({i // 10 for (i, v) in enumerate(values) if v is not None and (min is None or v >= min) and (max is None or v <= max)})
+
+            index_path = path + '.index'
+            for (column, descending) in [(0, False), (1, True), (2, False)]:
+                pq.write_table(table, path, row_group_size=10, sorting_columns=[pq.SortingColumn(column, descending=descending, nulls_first=True)])
+                pj.generate_metadata_index(path, index_path, sorted_key_index=True)
+                name = table.column_names[column]
+                values = sorted(v for v in table[name].to_pylist() if v is not None)
+                ranges = [(values[i], values[j]) for (i, j) in [(0, 0), (5, 37), (50, 51), (100, 189), (189, 189)]]
+                ranges += [(None, values[42]), (values[142], None), (None, None)]
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    reader = pj.IndexReader(index_path, read_mode=read_mode)
+                    self.assertEqual(reader.sorted_key_column, column)
+                    for (min, max) in ranges:
+                        self.assertEqual(reader.find_row_groups_by_key(min, max), expected_row_groups(name, min, max), (name, min, max))
+
+            pq.write_table(table, path, row_group_size=10, sorting_columns=[pq.SortingColumn(0, nulls_first=True)])
+            pj.generate_metadata_index(path, index_path, sorted_key_index=True, row_group_statistics=True)
+            reader = pj.IndexReader(index_path)
+            key = pa.scalar(1200, pa.timestamp('s'))
+            self.assertEqual(reader.find_row_groups_by_key(key, key), [2])
+            self.assertEqual(reader.find_row_groups_by_key(0, 3000000), [1, 2, 3, 4, 5])
+            self.assertEqual(reader.find_row_groups_by_key(100000000, None), [])
+
+            metadata = pj.read_metadata(index_path, key_range=(1200000, 1900000), column_names=['string'])
+            self.assertEqual(metadata.num_row_groups, 2)
+            self.assertEqual(metadata, pj.read_metadata(index_path, row_groups=[2, 3], column_names=['string']))
+            self.assertEqual(pj.read_metadata_bytes(index_path, key_range=(1200000, 1900000)), pj.read_metadata_bytes(index_path, row_groups=[2, 3]))
+            self.assertEqual(pj.read_metadata(index_path, key_range=(100000000, None)).num_row_groups, 0)
+
+            with self.assertRaises(RuntimeError) as context:
+                reader.find_row_groups_by_key(pa.scalar(1500, pa.timestamp('us')), None)
+            self.assertTrue("can't be compared with the sorted key column" in str(context.exception), context.exception)
+
+            with self.assertRaises(ValueError):
+                pj.read_metadata(index_path, key_range=(0, 1), row_range=(0, 1))
+
+            self.assertIsNone(pj.IndexReader(pj.generate_metadata_index(path)).sorted_key_column)
+            with self.assertRaises(RuntimeError) as context:
+                pj.IndexReader(pj.generate_metadata_index(path)).find_row_groups_by_key(0, 1)
+            self.assertTrue("The index has no sorted key" in str(context.exception), context.exception)
+
+            pq.write_table(table, path, row_group_size=10)
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, sorted_key_index=True)
+            self.assertTrue("don't declare the same sorting column" in str(context.exception), context.exception)
+
+            pq.write_table(table, path, row_group_size=10, sorting_columns=[pq.SortingColumn(1)])
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, sorted_key_index=True)
+            self.assertTrue("are not sorted by their sorting column" in str(context.exception), context.exception)
+
+    def test_project_arrow_schema(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            columns = 30
+            # The Parquet schema stores large_string and duration as string and int64, only the ARROW:schema keeps them
+            table = pa.table({f'column_{i}': pa.array(['a', 'b'], pa.large_string()) if i % 3 == 0 else pa.array([1, 2], pa.duration('s')) if i % 3 == 1 else pa.array([1.0, 2.0]) for i in range(columns)})
+            pq.write_table(table, path, row_group_size=1)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path)
+
+            column_indices = [4, 3, 8]
+            expected = pa.schema([table.schema.field(i) for i in column_indices])
+            for read_mode in ['full', 'ranges', 'mmap']:
+                reader = pj.IndexReader(index_path, read_mode=read_mode)
+                self.assertEqual(reader.read_schema(column_indices=column_indices, project_arrow_schema=True), expected)
+                self.assertEqual(reader.read_schema(project_arrow_schema=True).remove_metadata(), table.schema)
+                prepared = reader.prepare(column_indices=column_indices)
+                self.assertEqual(reader.read_schema(prepared=prepared, project_arrow_schema=True), expected)
+
+                metadata_bytes = reader.read_metadata_bytes(row_groups=[1], column_indices=column_indices)
+                projected_bytes = reader.read_metadata_bytes(row_groups=[1], column_indices=column_indices, project_arrow_schema=True)
+                self.assertLess(projected_bytes.size * 3, metadata_bytes.size)
+                self.assertEqual(reader.read_metadata_bytes(project_arrow_schema=True), reader.read_metadata_bytes())
+
+            # The default leaves the key-value metadata as it is
+            self.assertEqual(pj.read_metadata(index_path, column_indices=column_indices).metadata, pq.read_metadata(path).metadata)
+
+            metadata = pj.read_metadata(index_path, row_groups=[1], column_indices=column_indices, project_arrow_schema=True)
+            pr = pq.ParquetReader()
+            pr.open(path, metadata=metadata)
+            self.assertEqual(pr.read_all(), table.select(column_indices).slice(1))
+            self.assertEqual(pj.read_schema(index_path, column_names=['column_4', 'column_3', 'column_8'], project_arrow_schema=True), expected)
+
+            # Files without ARROW:schema are read as they are
+            pq.write_table(table, path, row_group_size=1, store_schema=False)
+            pj.generate_metadata_index(path, index_path)
+            self.assertEqual(pj.read_metadata_bytes(index_path, column_indices=column_indices, project_arrow_schema=True),
+                             pj.read_metadata_bytes(index_path, column_indices=column_indices))
+
+    def test_strip(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            table = pa.table({f'column_{i}': pa.array([f'{"value" * 20}_{j:04d}' for j in range(200)]) if i % 2 == 0 else pa.array(range(200)) for i in range(10)})
+            pq.write_table(table, path, row_group_size=10, write_page_index=True)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path, strip_ranges=True)
+
+            for read_mode in ['full', 'ranges', 'mmap']:
+                reader = pj.IndexReader(index_path, read_mode=read_mode)
+                self.assertLess(reader.read_metadata_bytes(strip=True).size * 2, reader.read_metadata_bytes().size)
+                for (row_groups, column_indices) in [([], []), ([3, 5], [4, 1]), ([19], [9])]:
+                    metadata = reader.read_metadata(row_groups=row_groups, column_indices=column_indices, strip=True)
+                    expected = reader.read_metadata(row_groups=row_groups, column_indices=column_indices)
+                    self.assertEqual(metadata.num_row_groups, expected.num_row_groups)
+                    for rg in range(metadata.num_row_groups):
+                        for c in range(metadata.num_columns):
+                            column = metadata.row_group(rg).column(c)
+                            expected_column = expected.row_group(rg).column(c)
+                            self.assertIsNone(column.statistics)
+                            self.assertIsNotNone(expected_column.statistics)
+                            self.assertEqual(column.data_page_offset, expected_column.data_page_offset)
+                            self.assertEqual(column.total_compressed_size, expected_column.total_compressed_size)
+                            self.assertEqual(column.has_offset_index, expected_column.has_offset_index)
+
+                    pr = pq.ParquetReader()
+                    pr.open(path, metadata=metadata)
+                    self.assertEqual(pr.read_all(), pq.ParquetFile(path).read_row_groups(row_groups or range(20), columns=[f'column_{c}' for c in column_indices] or None))
+
+            prepared = pj.prepare(reader, column_indices=[4, 1])
+            self.assertEqual(pj.read_metadata_bytes(index_path, row_groups=[3], prepared=prepared, strip=True),
+                             pj.read_metadata_bytes(index_path, row_groups=[3], column_indices=[4, 1], strip=True))
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.read_metadata(index_data=pj.generate_metadata_index(path), strip=True)
+            self.assertTrue("The index has no strip ranges" in str(context.exception), context.exception)
+
+    def test_nested_schema(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            n = 200
+            table = pa.table({'a': pa.array(range(n)),
+                              's': pa.array([{'x': i, 'y': {'p': str(i), 'q': float(i)}} for i in range(n)]),
+                              'l': pa.array([[i, i + 1] for i in range(n)]),
+                              'm': pa.array([[('k', i)] for i in range(n)], pa.map_(pa.string(), pa.int64())),
+                              'b': pa.array([str(i) for i in range(n)])})
+            pq.write_table(table, path, row_group_size=10)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path)
+
+            # Top-level names select all the leaves of a group, dotted paths a single leaf.
+            # A leaf of a map comes with the map's key, readers reject a map without it.
+            selections = [(['s'], [], ['s']), (['m', 'a'], [], ['m', 'a']), (['s.y.p', 'b'], [], ['s.y.p', 'b']), ([], [4, 0], ['l', 'a']), ([], [], None),
+                          (['m.key_value.value'], [], ['m']), ([], [6, 0], ['m', 'a'])]
+            for column_names_hash in [False, True]:
+                index_data = pj.generate_metadata_index(path, column_names_hash=column_names_hash)
+                self.assertEqual(index_data[:4], b'PJ_3')
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    reader = pj.IndexReader(index_path, read_mode=read_mode)
+                    for (column_names, column_indices, columns) in selections:
+                        metadata = pj.read_metadata(index_data=index_data, row_groups=[3, 5], column_names=column_names, column_indices=column_indices)
+                        self.assertEqual(reader.read_metadata(row_groups=[3, 5], column_names=column_names, column_indices=column_indices), metadata)
+                        pr = pq.ParquetReader()
+                        pr.open(path, metadata=metadata)
+                        self.assertEqual(pr.read_all(), pq.ParquetFile(path).read_row_groups([3, 5], columns=columns))
+
+            expected = pq.read_metadata(path)
+            self.assertEqual(pj.read_metadata(index_path), expected)
+            self.assertEqual(pj.read_schema(index_path, column_names=['s']), pq.read_schema(path).remove(4).remove(3).remove(2).remove(0))
+            self.assertEqual(pj.read_metadata(index_path, column_names=['s', 'a']).schema.column(0).path, 's.x')
+
+            statistics = pj.IndexReader(pj.generate_metadata_index(path, row_group_statistics=True)).read_row_group_statistics(column_names=['s', 'b'])
+            self.assertEqual(statistics.schema.names, ['s.x', 's.y.p', 's.y.q', 'b'])
+
+            for strip in [False, True]:
+                metadata = pj.read_metadata(index_data=pj.generate_metadata_index(path, strip_ranges=True), column_names=['m.key_value.value'], strip=strip, project_arrow_schema=True)
+                self.assertEqual([metadata.schema.column(i).path for i in range(metadata.num_columns)], ['m.key_value.key', 'm.key_value.value'])
+
+            prepared = pj.prepare(pj.IndexReader(index_path), column_names=['l', 's.y'])
+            self.assertEqual(pj.read_metadata(index_path, row_groups=[1], prepared=prepared), pj.read_metadata(index_path, row_groups=[1], column_indices=[4, 2, 3]))
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, format_version=2)
+            self.assertTrue("nested schemas need index format version 3!" in str(context.exception), context.exception)
+
+    def test_index_reader_threads(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            pq.write_table(get_table(), path, row_group_size=chunk_size)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path)
+
+            selections = [([r], [f'column_{c}']) for r in range(n_row_groups) for c in range(n_columns)]
+            expected = [pj.read_metadata(index_path, row_groups=r, column_names=c) for (r, c) in selections]
+
+            for read_mode in ['full', 'ranges', 'mmap']:
+                reader = pj.IndexReader(index_path, read_mode=read_mode)
+                with concurrent.futures.ThreadPoolExecutor(max_workers=8) as pool:
+                    actual = list(pool.map(lambda s: reader.read_metadata(row_groups=s[0], column_names=s[1]), selections * 10))
+
+                self.assertEqual(actual, expected * 10, f"read_mode={read_mode}")
+
+    def test_column_names_hash(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            table = get_table()
+            # Duplicate names resolve to the last column with the name, same as without the hash table
+            table = table.append_column('column_1', pa.array(np.random.rand(n_row_groups)))
+            pq.write_table(table, path, row_group_size=chunk_size)
+            index_path = path + '.index'
+            hashed_index_path = path + '.hashed.index'
+            pj.generate_metadata_index(path, index_path)
+            pj.generate_metadata_index(path, hashed_index_path, column_names_hash=True)
+            index_data = pj.generate_metadata_index(path)
+            hashed_index_data = pj.generate_metadata_index(path, column_names_hash=True)
+
+            # The hash table is appended after the unchanged index body
+            self.assertGreater(len(hashed_index_data), len(index_data))
+            self.assertEqual(hashed_index_data[:len(index_data)], index_data)
+            self.assertEqual(fs.LocalFileSystem().open_input_stream(hashed_index_path).readall(), hashed_index_data)
+
+            readers = [pj.IndexReader(hashed_index_data)]
+            readers.extend(pj.IndexReader(hashed_index_path, read_mode=read_mode) for read_mode in ['full', 'ranges', 'mmap'])
+            selections = [['column_0'], ['column_6', 'column_2'], ['column_1'], table.column_names]
+            for column_names in selections:
+                expected = pj.read_metadata(index_data=index_data, row_groups=[1], column_names=column_names)
+                self.assertEqual(pj.read_metadata(index_data=hashed_index_data, row_groups=[1], column_names=column_names), expected)
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    self.assertEqual(pj.read_metadata(hashed_index_path, row_groups=[1], column_names=column_names, read_mode=read_mode), expected)
+                for reader in readers:
+                    self.assertEqual(reader.read_metadata(row_groups=[1], column_names=column_names), expected)
+
+            for reader in readers:
+                self.assertEqual(reader.read_metadata(), pj.read_metadata(index_path))
+                with self.assertRaises(RuntimeError) as context:
+                    reader.read_metadata(column_names=["no_such_column"])
+                self.assertTrue("Couldn't find a column with a name 'no_such_column'!" in str(context.exception), context.exception)
+
+    def test_format_version_3(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            pq.write_table(get_table(), path, row_group_size=chunk_size)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path, format_version=3)
+            index_data = pj.generate_metadata_index(path, format_version=3)
+            index_data_v2 = pj.generate_metadata_index(path)
+
+            self.assertEqual(index_data[:4], b'PJ_3')
+            self.assertEqual(index_data_v2[:4], b'PJ_2')
+            self.assertEqual(pj.generate_metadata_index(path, format_version=2), index_data_v2)
+            self.assertEqual(fs.LocalFileSystem().open_input_stream(index_path).readall(), index_data)
+            self.assertEqual(pj.generate_metadata_index(path, column_names_hash=True, format_version=3)[:len(index_data)], index_data)
+
+            for (row_groups, column_indices) in [([], []), ([1], [0, 2]), ([n_row_groups - 1, 0], [n_columns - 1])]:
+                expected = pj.read_metadata(index_data=index_data_v2, row_groups=row_groups, column_indices=column_indices)
+                self.assertEqual(pj.read_metadata(index_data=index_data, row_groups=row_groups, column_indices=column_indices), expected)
+                self.assertEqual(pj.IndexReader(index_data).read_metadata(row_groups=row_groups, column_indices=column_indices), expected)
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    self.assertEqual(pj.read_metadata(index_path, row_groups=row_groups, column_indices=column_indices, read_mode=read_mode), expected)
+                    self.assertEqual(pj.IndexReader(index_path, read_mode=read_mode).read_metadata(row_groups=row_groups, column_indices=column_indices), expected)
+
+            # Row counts are stored as int64 right after the 32-byte header and the 2 num_rows offsets
+            large_index_data = bytearray(index_data)
+            large_index_data[40:48] = (5 << 32).to_bytes(8, 'little')
+            self.assertEqual(pj.read_metadata(index_data=large_index_data, row_groups=[0]).num_rows, 5 << 32)
+
+            invalid_version_data = bytearray(index_data)
+            invalid_version_data[4:8] = (4).to_bytes(4, 'little')
+            with self.assertRaises(RuntimeError) as context:
+                pj.IndexReader(invalid_version_data)
+            self.assertTrue("Index format version=4 is not supported!" in str(context.exception), context.exception)
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, format_version=1)
+            self.assertTrue("Index format version=1 is not supported!" in str(context.exception), context.exception)
+
+    def test_packed_offsets(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            # Wide enough for several blocks of packed offsets per row group
+            columns = 100
+            table = pa.Table.from_arrays([pa.array(np.random.rand(n_row_groups)) for _ in range(columns)], names=[f'column_{i}' for i in range(columns)])
+            pq.write_table(table, path, row_group_size=chunk_size)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path, packed_offsets=True, column_names_hash=True)
+            index_data = pj.generate_metadata_index(path)
+            packed_index_data = pj.generate_metadata_index(path, packed_offsets=True)
+
+            self.assertEqual(packed_index_data[:4], b'PJ_3')
+            self.assertLess(len(packed_index_data), len(index_data))
+
+            readers = [pj.IndexReader(packed_index_data)]
+            readers.extend(pj.IndexReader(index_path, read_mode=read_mode) for read_mode in ['full', 'ranges', 'mmap'])
+            selections = [([], []), ([], [0]), ([3], [99, 0, 31, 32, 63]), ([4, 0], list(range(columns))), ([2, 2], [64, 1])]
+            for (row_groups, column_indices) in selections:
+                expected = pj.read_metadata(index_data=index_data, row_groups=row_groups, column_indices=column_indices)
+                self.assertEqual(pj.read_metadata(index_data=packed_index_data, row_groups=row_groups, column_indices=column_indices), expected)
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    self.assertEqual(pj.read_metadata(index_path, row_groups=row_groups, column_indices=column_indices, read_mode=read_mode), expected)
+                for reader in readers:
+                    self.assertEqual(reader.read_metadata(row_groups=row_groups, column_indices=column_indices), expected)
+
+            self.assertEqual(readers[2].read_metadata(row_groups=[1], column_names=['column_77']), pj.read_metadata(index_data=index_data, row_groups=[1], column_names=['column_77']))
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, packed_offsets=True, format_version=2)
+            self.assertTrue("Packed offsets need index format version 3!" in str(context.exception), context.exception)
+
+            # Flags are at offset 24 of the PJ_3 header
+            unknown_flags_data = bytearray(packed_index_data)
+            for flags in [9, 3]:
+                unknown_flags_data[24:28] = flags.to_bytes(4, 'little')
+                with self.assertRaises(RuntimeError) as context:
+                    pj.IndexReader(unknown_flags_data)
+                self.assertTrue(f"Index flags={flags} are not supported!" in str(context.exception), context.exception)
+
+    def test_column_major_offsets(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            pq.write_table(get_table(), path, row_group_size=chunk_size)
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path, column_major_offsets=True)
+            index_data = pj.generate_metadata_index(path)
+            column_major_index_data = pj.generate_metadata_index(path, column_major_offsets=True, column_names_hash=True)
+
+            self.assertEqual(column_major_index_data[:4], b'PJ_3')
+            readers = [pj.IndexReader(column_major_index_data)]
+            readers.extend(pj.IndexReader(index_path, read_mode=read_mode) for read_mode in ['full', 'ranges', 'mmap'])
+            selections = [([], []), ([], [3]), ([3, 1], [6, 0]), ([4], list(range(n_columns))), ([2, 2], [5, 1])]
+            for (row_groups, column_indices) in selections:
+                expected = pj.read_metadata(index_data=index_data, row_groups=row_groups, column_indices=column_indices)
+                self.assertEqual(pj.read_metadata(index_data=column_major_index_data, row_groups=row_groups, column_indices=column_indices), expected)
+                for read_mode in ['full', 'ranges', 'mmap']:
+                    self.assertEqual(pj.read_metadata(index_path, row_groups=row_groups, column_indices=column_indices, read_mode=read_mode), expected)
+                for reader in readers:
+                    self.assertEqual(reader.read_metadata(row_groups=row_groups, column_indices=column_indices), expected)
+
+            self.assertEqual(readers[0].read_metadata(column_names=['column_2']), pj.read_metadata(index_data=index_data, column_names=['column_2']))
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, column_major_offsets=True, packed_offsets=True)
+            self.assertTrue("Packed offsets and column-major offsets can't be combined!" in str(context.exception), context.exception)
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path, column_major_offsets=True, format_version=2)
+            self.assertTrue("Column-major offsets need index format version 3!" in str(context.exception), context.exception)
+
+    def test_index_reader_invalid_index_file(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            pq.write_table(get_table(), path, row_group_size=chunk_size)
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.IndexReader(path)
+            self.assertTrue(f"File '{path}' has unexpected format!" in str(context.exception), context.exception)
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.IndexReader(b'PJ_2')
+            self.assertTrue("Index data is too small, length=4" in str(context.exception), context.exception)
+
     def test_reading_invalid_row_group(self):
         with tempfile.TemporaryDirectory() as tmpdirname:
             path = os.path.join(tmpdirname, "my.parquet")
@@ -331,6 +994,204 @@ class TestPalletJack(unittest.TestCase):
             # Compare the actual output to the expected output
             self.assertEqual(index_data1, index_data2)
 
+    def test_inmemory_index_data_buffer_protocol(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            pq.write_table(get_table(), path, row_group_size=chunk_size)
+
+            index_path = path + '.index'
+            pj.generate_metadata_index(path, index_path)
+            index_data = pj.generate_metadata_index(path)
+            self.assertIsInstance(index_data, pa.Buffer)
+
+            expected = pj.read_metadata(index_path, row_groups=[1, 3], column_indices=[2])
+            with open(index_path, 'rb') as f:
+                index_mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+                for data in [index_data, index_mmap, memoryview(index_mmap), bytes(index_data), bytearray(index_data)]:
+                    self.assertEqual(pj.read_metadata(index_data=data, row_groups=[1, 3], column_indices=[2]), expected)
+                    self.assertEqual(pj.read_schema(index_data=data, column_indices=[2]), expected.schema.to_arrow_schema())
+                    self.assertEqual(pj.IndexReader(data).read_metadata(row_groups=[1, 3], column_indices=[2]), expected)
+
+                index_mmap.close()
+
+    def test_generate_metadata_indexes(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            paths = []
+            for i in range(10):
+                path = os.path.join(tmpdirname, f"my{i}.parquet")
+                pq.write_table(get_table(), path, row_group_size=chunk_size)
+                paths.append((path, path + '.index'))
+
+            not_parquet_path = os.path.join(tmpdirname, "not_parquet.parquet")
+            with open(not_parquet_path, 'wb') as f:
+                f.write(b'not a parquet file')
+            missing_path = os.path.join(tmpdirname, "missing.parquet")
+            paths.insert(3, (not_parquet_path, not_parquet_path + '.index'))
+            paths.insert(7, (missing_path, missing_path + '.index'))
+
+            for (num_threads, memory_limit) in [(0, 1 << 30), (1, 1 << 30), (4, 1 << 30), (4, 1)]:
+                errors = pj.generate_metadata_indexes(paths, num_threads=num_threads, memory_limit=memory_limit, column_names_hash=True)
+                self.assertEqual(len(errors), len(paths))
+                self.assertIn("Parquet magic bytes not found in footer", errors[3])
+                self.assertIn("missing.parquet", errors[7])
+                self.assertFalse(os.path.exists(not_parquet_path + '.index'))
+                self.assertFalse(os.path.exists(missing_path + '.index'))
+
+                for (i, (path, index_path)) in enumerate(paths):
+                    if i in [3, 7]:
+                        continue
+
+                    self.assertIsNone(errors[i])
+                    self.assertEqual(fs.LocalFileSystem().open_input_stream(index_path).readall(), pj.generate_metadata_index(path, column_names_hash=True))
+                    os.remove(index_path)
+
+            self.assertEqual(pj.generate_metadata_indexes([]), [])
+
+    def test_index_pack(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            paths = []
+            for i in range(20):
+                path = os.path.join(tmpdirname, f"my{i}.parquet")
+                table = pa.table({f'column_{c}': pa.array(range(10 * (i + 1))) for c in range(1 + i % 4)})
+                pq.write_table(table, path, row_group_size=10)
+                paths.append(path)
+
+            pack_path = os.path.join(tmpdirname, "my.pack")
+            pj.generate_index_pack(paths, pack_path, num_threads=4, column_names_hash=True)
+            pack_data = pj.generate_index_pack(paths, num_threads=1, column_names_hash=True)
+            self.assertEqual(pack_data[:4], b'PJP1')
+            self.assertEqual(fs.LocalFileSystem().open_input_stream(pack_path).readall(), pack_data)
+
+            with open(pack_path, 'rb') as f:
+                pack_mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+                for pack in [pj.IndexPack(pack_path), pj.IndexPack(pack_data), pj.IndexPack(pack_mmap)]:
+                    self.assertEqual(len(pack), len(paths))
+                    self.assertEqual(sorted(pack.keys()), sorted(paths))
+                    self.assertNotIn(paths[0] + '.index', pack)
+                    for (i, path) in enumerate(paths):
+                        self.assertIn(path, pack)
+                        index_data = pj.generate_metadata_index(path, column_names_hash=True)
+                        self.assertEqual(pack.read_metadata(path), pj.read_metadata(index_data=index_data))
+                        self.assertEqual(pack.read_metadata(path, row_groups=[i], column_names=['column_0']), pj.read_metadata(index_data=index_data, row_groups=[i], column_names=['column_0']))
+                        self.assertEqual(pack.read_metadata_bytes(path, row_range=(5, 10 * (i + 1))), pj.read_metadata_bytes(index_data=index_data, row_range=(5, 10 * (i + 1))))
+                        self.assertEqual(pack.read_schema(path), pq.read_schema(path))
+                        self.assertEqual(pack.reader(path).num_rows, 10 * (i + 1))
+
+                    with self.assertRaises(KeyError):
+                        pack.reader('missing.parquet')
+
+                # The mapping cannot be closed while the pack still references it
+                del pack
+                pack_mmap.close()
+
+            # The readers keep the pack alive
+            reader = pj.IndexPack(pj.generate_index_pack(paths[:2], keys=['a', 'b'])).reader('b')
+            self.assertEqual(reader.read_metadata(), pq.read_metadata(paths[1]))
+
+            builder = pj.IndexPackBuilder()
+            builder.add('a', pj.generate_metadata_index(paths[0]))
+            builder.add('a', pj.generate_metadata_index(paths[1]))
+            self.assertEqual(len(builder), 2)
+            with self.assertRaises(RuntimeError) as context:
+                builder.finish()
+            self.assertTrue("Index pack key 'a' is added more than once!" in str(context.exception), context.exception)
+
+            with self.assertRaises(RuntimeError) as context:
+                builder.add('b', b'not an index')
+            with self.assertRaises(RuntimeError) as context:
+                pj.IndexPack(pj.generate_metadata_index(paths[0]))
+            self.assertTrue("Index pack has unexpected format!" in str(context.exception), context.exception)
+
+            self.assertEqual(len(pj.IndexPack(pj.IndexPackBuilder().finish())), 0)
+
+            # Truncated packs and packs with a damaged directory are rejected when opened
+            pack_bytes = pack_data.to_pybytes()
+            for damaged in [pack_bytes[:100], pack_bytes[:16] + bytes(1024) + pack_bytes[16 + 1024:]]:
+                with self.assertRaises(RuntimeError):
+                    pj.IndexPack(damaged)
+
+    def test_dataset(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            paths = []
+            for i in range(4):
+                path = os.path.join(tmpdirname, f"part={i}", "my.parquet")
+                os.makedirs(os.path.dirname(path))
+                table = pa.table({f'column_{c}': pa.array(np.arange(100) + 100 * i) for c in range(10)})
+                table = table.append_column('text', pa.array([str(v) for v in range(100)], pa.large_string()))
+                pq.write_table(table, path, row_group_size=10)
+                pj.generate_metadata_index(path, path + '.index')
+                paths.append(path)
+
+            expected = pq.read_table(paths, columns=['column_1', 'text'])
+            pack = pj.IndexPack(pj.generate_index_pack(paths))
+
+            # The fragments get their metadata from the indexes, so the footers are never read
+            for path in paths:
+                with open(path, 'r+b') as f:
+                    f.seek(-8, os.SEEK_END)
+                    f.write(bytes(8))
+
+            for index_paths in [None, [path + '.index' for path in paths], pack]:
+                dataset = pj.dataset(paths, index_paths, columns=['column_1', 'text'])
+                self.assertEqual(dataset.schema, expected.schema)
+                self.assertEqual(dataset.to_table(), expected)
+                self.assertEqual(dataset.to_table(filter=pc.field('column_1') >= 395).column('column_1').to_pylist(), list(range(395, 400)))
+                fragments = list(dataset.get_fragments())
+                self.assertEqual([fragment.path for fragment in fragments], [path.replace(os.sep, '/') for path in paths])
+                self.assertEqual(fragments[2].metadata.num_columns, 2)
+
+                row_group_fragments = fragments[1].split_by_row_group(filter=pc.field('column_1') < 125)
+                self.assertEqual(len(row_group_fragments), 3)
+                self.assertEqual(row_group_fragments[2].to_table(), expected.slice(120, 10))
+
+            all_columns = pj.dataset(paths).to_table()
+            self.assertEqual(all_columns.schema, pj.read_schema(paths[0] + '.index'))
+            self.assertEqual(all_columns.select(['column_1', 'text']), expected)
+
+            # Both the data files and the default index paths are opened through the filesystem
+            filesystem = fs.SubTreeFileSystem(tmpdirname, fs.LocalFileSystem())
+            relative_paths = [f"part={i}/my.parquet" for i in range(4)]
+            dataset = pj.dataset(relative_paths, columns=['column_1', 'text'], filesystem=filesystem)
+            self.assertEqual(dataset.to_table(), expected)
+            self.assertEqual([fragment.path for fragment in dataset.get_fragments()], relative_paths)
+
+            with self.assertRaises(FileNotFoundError):
+                pj.dataset(paths, filesystem=filesystem)
+
+            with self.assertRaises(ValueError):
+                pj.dataset(paths, paths[:1])
+
+    def test_large_footer(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            # The footer is larger than the speculative tail read, so it needs a second read
+            table = pa.Table.from_arrays([pa.array(np.random.rand(20)) for i in range(300)], names=[f'column_{i}' for i in range(300)])
+            pq.write_table(table, path, row_group_size=2)
+
+            pr = pq.ParquetReader()
+            pr.open(path)
+            self.assertGreater(pr.metadata.serialized_size, 64 * 1024)
+            index_data = pj.generate_metadata_index(path)
+            self.assertEqual(pj.read_metadata(index_data=index_data), pr.metadata)
+            self.assertEqual(pj.read_metadata(index_data=index_data, row_groups=[3], column_indices=[7]).to_dict()['row_groups'][0]['columns'][0],
+                             pr.metadata.row_group(3).column(7).to_dict())
+            pr.close()
+
+    def test_generate_metadata_index_invalid_parquet_file(self):
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            path = os.path.join(tmpdirname, "my.parquet")
+            with open(path, 'wb') as f:
+                f.write(b'not a parquet file')
+
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path)
+            self.assertIn("Parquet magic bytes not found in footer", str(context.exception))
+
+            open(path, 'wb').close()
+            with self.assertRaises(RuntimeError) as context:
+                pj.generate_metadata_index(path)
+            self.assertIn("Parquet file size is 0 bytes", str(context.exception))
+
     def test_encrypted_footer_parquet(self):
         with tempfile.TemporaryDirectory() as tmpdirname:
             path = os.path.join(tmpdirname, "encrypted_footer.parquet")
@@ -30,6 +30,39 @@ pj.generate_metadata_index(path, index_path)
 index_data = pj.generate_metadata_index(path)
 # ```
 
+### Generating the metadata index with a column names hash table (faster selection by column names on files with many columns):
+# ```
+pj.generate_metadata_index(path, index_path, column_names_hash = True)
+# ```
+
+### Generating the metadata index with bit-packed column chunk offsets (several times smaller offset tables on files with many columns and row groups):
+# ```
+pj.generate_metadata_index(path, index_path, packed_offsets = True)
+# ```
+
+### Generating the metadata index with column-major column chunk offsets (faster reading of a few columns over many row groups):
+# ```
+pj.generate_metadata_index(path, index_path, column_major_offsets = True)
+# ```
+
+### Generating the metadata index with row group statistics (min, max and null counts of every column chunk, read without decoding any Thrift):
+# ```
+pj.generate_metadata_index(path, index_path, row_group_statistics = True)
+statistics = pj.IndexReader(index_path).read_row_group_statistics(column_names = ['column_1', 'column_3'])
+# ```
+
+### Generating the metadata index files for many parquet files in parallel (returns an error message or None per file):
+# ```
+errors = pj.generate_metadata_indexes([(path, index_path)], num_threads = 8)
+# ```
+
+### Packing the indexes of many parquet files into a single file (opened and memory mapped once, the indexes are looked up by key):
+# ```
+pj.generate_index_pack([path], 'my.pack', keys = ['my.parquet'])
+pack = pj.IndexPack('my.pack')
+metadata = pack.read_metadata('my.parquet', row_groups = [5, 7])
+# ```
+
 ### Writing the in-memory metadata index to a file using pyarrow's fs:
 # ```
 fs.LocalFileSystem().open_output_stream(index_path).write(index_data)
@@ -56,6 +89,14 @@ pr.open(path, metadata=metadata)
 data = pr.read_all()
 # ```
 
+### Reading the in-memory metadata index from any buffer without copying it (e.g. a memory-mapped file):
+# ```
+import mmap
+with open(index_path, 'rb') as f:
+    index_mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+metadata = pj.read_metadata(index_data = index_mmap, row_groups = [5, 7])
+# ```
+
 ### Reading a subset of columns using column indices:
 # ```
 metadata = pj.read_metadata(index_path, column_indices = [1, 3])
@@ -81,6 +122,57 @@ pr.open(path, metadata=metadata)
 data = pr.read_all()
 # ```
 
+### Reading only the needed parts of the index file (e.g. on a network filesystem):
+# ```
+metadata = pj.read_metadata(index_path, row_groups = [5, 7], column_indices = [1, 3], read_mode = 'ranges')
+# ```
+
+### Reading the index file through a memory map (repeated reads are served from the page cache):
+# ```
+metadata = pj.read_metadata(index_path, row_groups = [5, 7], column_indices = [1, 3], read_mode = 'mmap')
+# ```
+
+### Reusing an index handle for many reads (the handle can be shared between threads):
+# ```
+reader = pj.IndexReader(index_path)
+metadata = reader.read_metadata(row_groups = [5, 7], column_names = ['column_1', 'column_3'])
+pr = pq.ParquetReader()
+pr.open(path, metadata=metadata)
+data = pr.read_all()
+# ```
+
+### Reading the row groups covering a range of rows:
+# ```
+metadata = pj.read_metadata(index_path, row_range = (10500, 12500))
+row_groups, first_row_group_offset, last_row_group_stop = reader.find_row_groups(10500, 12500)
+# ```
+
+### Finding the row groups that may match a filter (requires an index with row group statistics):
+# ```
+import pyarrow.compute as pc
+pj.generate_metadata_index(path, index_path, row_group_statistics = True)
+row_groups = pj.prune_row_groups(index_path, (pc.field('column_1') > 0.5) & (pc.field('column_3') < 0.1))
+metadata = pj.read_metadata(index_path, row_groups = row_groups)
+# ```
+
+### Preparing a column selection once for many reads (also for other files with the same schema):
+# ```
+prepared = pj.prepare(reader, column_names = ['column_1', 'column_3'])
+metadata = reader.read_metadata(row_groups = [5, 7], prepared = prepared)
+metadata = pj.read_metadata(index_path, row_groups = [8], prepared = prepared)
+# ```
+
+### Reading the Thrift-encoded metadata without parsing it (e.g. for non-Arrow readers):
+# ```
+metadata_bytes = pj.read_metadata_bytes(index_path, row_groups = [5, 7], column_indices = [1, 3])
+# ```
+
+### Reading minimal metadata for data reads, without the statistics, encoding stats and bloom filter fields of the column chunks (requires an index generated with strip_ranges):
+# ```
+pj.generate_metadata_index(path, index_path, strip_ranges = True)
+metadata = pj.read_metadata(index_path, row_groups = [5, 7], column_indices = [1, 3], strip = True)
+# ```
+
 ### Reading the schema
 # ```
 schema = pj.read_schema(index_path)
@@ -91,3 +183,30 @@ schema = pj.read_schema(index_path)
 schema = pj.read_schema(index_path, column_indices = [1, 3])
 schema = pj.read_schema(index_path, column_names = ['column_1', 'column_3'])
 # ```
+
+### Keeping the Arrow types of the selected columns (the ARROW:schema written by Arrow is projected instead of copied whole):
+# ```
+schema = pj.read_schema(index_path, column_names = ['column_1', 'column_3'], project_arrow_schema = True)
+metadata = pj.read_metadata(index_path, row_groups = [5, 7], column_names = ['column_1', 'column_3'], project_arrow_schema = True)
+# ```
+
+### Reading the row groups of a key range of a file sorted by a column (requires an index generated with sorted_key_index):
+# ```
+pq.write_table(table.sort_by('column_0'), path, row_group_size=chunk_size, sorting_columns=[pq.SortingColumn(0)], store_schema=False)
+pj.generate_metadata_index(path, index_path, sorted_key_index = True)
+metadata = pj.read_metadata(index_path, key_range = (0.25, 0.5))
+# ```
+
+### Building a pyarrow dataset whose fragments get their metadata from the indexes (scans, split_by_row_group and filter pushdown never read the footers):
+# ```
+dataset = pj.dataset([path], [index_path], columns = ['column_1', 'column_3'])
+table = dataset.to_table(filter = pc.field('column_1') > 0.5)
+# ```
+
+### Reading a subset of columns of a nested schema (dotted paths select a single leaf, top-level names all the leaves of a field):
+# ```
+pq.write_table(pa.table({'id': pa.array(range(rows)), 'point': pa.array([{'x': i, 'y': float(i)} for i in range(rows)])}), path, row_group_size=chunk_size)
+pj.generate_metadata_index(path, index_path)
+metadata = pj.read_metadata(index_path, row_groups = [5, 7], column_names = ['point'])
+metadata = pj.read_metadata(index_path, row_groups = [5, 7], column_names = ['point.y', 'id'])
+# ```